@@ -46,8 +46,9 @@ typedef unsigned int uint;
 
 
 
-%include "std_shared_ptr.i"
-%shared_ptr(carl::Monomial);
+// Monomial::Arg is an intrusive handle, the reference count is stored within the monomial.
+%include "boost_intrusive_ptr.i"
+%intrusive_ptr(carl::Monomial);
 
 typedef std::pair<carl::Variable,uint> VarIntPair;
 namespace std {
@@ -77,7 +78,7 @@ typedef unsigned int exponent;
 
 class Monomial {
 public:
-typedef std::shared_ptr<const carl::Monomial> Arg;
+typedef boost::intrusive_ptr<const carl::Monomial> Arg;
 typedef std::vector<VarIntPair> Content;
 
 /*
@@ -107,32 +108,27 @@ size_t nrVariables() const;
 	}
 
 	Polynomial add(const Polynomial& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr+rhs;
 	}
 
 	Polynomial add(const Term& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr+rhs;
 	}
 
 	Polynomial add(const Monomial::Arg& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator+<Rational,carl::GrLexOrdering,carl::StdMultivariatePolynomialPolicies<>>(ptr,rhs);
 	} 
 
 	Polynomial add(carl::Variable::Arg rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator+<Rational,carl::GrLexOrdering,carl::StdMultivariatePolynomialPolicies<>>(ptr,rhs);
 	} 
 
 	Polynomial add(const Rational& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr+rhs;
 	}
 
@@ -140,108 +136,90 @@ size_t nrVariables() const;
 
 
 	Polynomial sub(const Polynomial& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr-rhs;
 	}
 
 	Polynomial sub(const Term& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr-rhs;
 	}
 
 	Polynomial sub(const Monomial::Arg& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator-<Rational,carl::GrLexOrdering,carl::StdMultivariatePolynomialPolicies<>>(ptr,rhs);
 	} 
 
 	Polynomial sub(carl::Variable::Arg rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator-<Rational,carl::GrLexOrdering,carl::StdMultivariatePolynomialPolicies<>>(ptr,rhs);
 	} 
 
 	Polynomial sub(const Rational& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr-rhs;
 	}
 
 
 
 	Polynomial mul(const Polynomial& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return rhs*ptr;
 	}
 
 	Term mul(const Term& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr*rhs;
 	}
 
 	Polynomial mul(const Monomial::Arg& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
-	    //const std::shared_ptr<const carl::Monomial> ptr2(rhs);
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator*(ptr,Polynomial(rhs));
 	} 
 
 	Polynomial mul(carl::Variable::Arg rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return carl::operator*(ptr,Polynomial(rhs));
 	}  
 
 	Term mul(const Rational& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 	    return ptr*rhs;
 	}
 
 
 	RationalFunction div(const RationalFunction& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 		return RationalFunction(Polynomial(ptr)) / rhs;
 	}
 
 	RationalFunction div(const Polynomial& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 		return RationalFunction(Polynomial(ptr)) / rhs;
 	}
 
 	RationalFunction div(const Term& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 		return RationalFunction(Polynomial(ptr)) / rhs;
 	}
 
 	RationalFunction div(const Monomial::Arg& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 		return RationalFunction(Polynomial(ptr)) / rhs;
 	}
 
 	RationalFunction div(carl::Variable::Arg rhs) {
-	        carl::Monomial::Content exp($self->exponents());	
-	        const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	        carl::Monomial::Arg ptr($self);
 		return RationalFunction(Polynomial(ptr)) / rhs;
 	}
 
 	Term div(const Rational& rhs) {
-	    carl::Monomial::Content exp($self->exponents());	
-	    const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	    carl::Monomial::Arg ptr($self);
 		return Term(ptr) / rhs;
 	}
 
 	Term neg() {
-		carl::Monomial::Content exp($self->exponents());	
-	        const std::shared_ptr<const carl::Monomial> ptr = std::make_shared<const carl::Monomial>(std::move(exp));
+	        carl::Monomial::Arg ptr($self);
 		return ptr*Rational(-1);
 	}
 
@@ -53,7 +53,7 @@ public:
 typedef Coeff CoeffType;
 typedef Coeff NumberType; //ATTENTION: This is only correct if polynomials are never instantiated with a type that's not a number
 explicit MultivariatePolynomial(const carl::Term<Coeff>& t);
-explicit MultivariatePolynomial(const std::shared_ptr<const carl::Monomial>& m);
+explicit MultivariatePolynomial(const carl::Monomial::Arg& m);
 explicit MultivariatePolynomial(Variable::Arg v);
 explicit MultivariatePolynomial(const Coeff& c);
 const Coeff& constantPart() const;
@@ -31,10 +31,13 @@
 
 #include <atomic>
 #include <list>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "../core/UnivariatePolynomial.h"
 #include "../core/MultivariatePolynomial.h"
 #include "../core/Variable.h"
@@ -111,6 +114,42 @@ private:
 	cad::CADSettings setting;
 	
 	cad::CADConstraints<Number> mConstraints;
+
+	/**
+	 * statistics of each thread of the last parallel lifting
+	 */
+	std::vector<cad::LiftingStatistics> liftingStatistics;
+
+	/**
+	 * Undo record of a single change of the sample tree.
+	 */
+	struct SampleChange {
+		enum class Kind { INSERTED, REPLACED, DETACHED };
+		Kind kind;
+		/// the node that was inserted, replaced or detached
+		sampleIterator node;
+		/// the former sample of a replaced node
+		boost::optional<RealAlgebraicNumber<Number>> sample;
+	};
+
+	/**
+	 * State of the CAD saved by checkpoint().
+	 * The sample tree is restored by undoing the recorded changes in reverse order.
+	 * The elimination sets and the polynomials are copied when they are about to be changed for the first time after the checkpoint was created.
+	 */
+	struct Checkpoint {
+		cad::Variables variables;
+		cad::CADConstraints<Number> constraints;
+		bool iscomplete;
+		std::vector<SampleChange> sampleChanges;
+		boost::optional<std::vector<cad::EliminationSet<Number>>> eliminationSets;
+		boost::optional<typename cad::CADPolynomials<Number>::Snapshot> polynomials;
+	};
+
+	/**
+	 * Checkpoints in the order they were created, restored by rollback().
+	 */
+	std::vector<Checkpoint> mTrail;
 	
 	static unsigned checkCallCount;
 
@@ -180,6 +219,13 @@ public:
 		return sampleTree;
 	}
 
+	/**
+	 * @return statistics of each thread of the last parallel lifting, see CADSettings::liftingThreads
+	 */
+	const std::vector<cad::LiftingStatistics>& getLiftingStatistics() const {
+		return this->liftingStatistics;
+	}
+
 	/**
 	* @return list of main variables of the polynomials of this cad
 	*/
@@ -335,6 +381,19 @@ public:
 		return this->check(_constraints, r, cg, bounds, next, checkBounds);
 	}
 
+	/**
+	 * Constructs the single cell of a decomposition that contains the given point, without building the full elimination sets and sample tree.
+	 * Starting with the scheduled and input polynomials, every level determines the closest roots below and above the point (or the root at the point).
+	 * Only the polynomials needed for the sign-invariance of this cell are projected to the next level: the single projections of all polynomials,
+	 * and the resultants of the polynomials defining the bounds with all others.
+	 * Remarks:
+	 *  - The bounds are given as comparisons of the variables with MultivariateRoot objects.
+	 *  - A level without bounds does not contribute any bound.
+	 * @param point a point that assigns a value to every variable of this cad, the values are ordered like getVariables()
+	 * @return bounds describing the cell, starting with the first eliminated variable
+	 */
+	std::vector<cad::CellBound<Number>> constructCell(const RealAlgebraicPoint<Number>& point);
+
 	/**
 	 * Insert the given polynomial into the cad.
 	 * Creates a copy from the given polynomial.
@@ -345,6 +404,31 @@ public:
 	 */
 	void addPolynomial(const MPolynomial& p, const std::vector<Variable>& v);
 	
+	/**
+	 * Saves the current state of the cad, including the elimination sets with their queues and the sample tree.
+	 * A later call to rollback() restores this state, such that the polynomials added in between are removed without recomputing any projection.
+	 * Checkpoints can be nested, for example to follow the push and pop operations of an SMT solver.
+	 * Remarks:
+	 *  - The polynomials are owned by the cad until it is destroyed, hence checkpoints share them instead of copying them.
+	 *  - Changes of the sample tree are recorded and undone by rollback(), erased samples are kept until then.
+	 *  - The elimination sets are copied once they are changed after the checkpoint was created.
+	 * @return the number of checkpoints, including the new one
+	 */
+	std::size_t checkpoint();
+
+	/**
+	 * Restores the state of the last checkpoint and removes this checkpoint.
+	 * Asserts that there is a checkpoint.
+	 */
+	void rollback();
+
+	/**
+	 * @return the number of checkpoints that can be restored
+	 */
+	std::size_t checkpoints() const {
+		return mTrail.size();
+	}
+
 	/**
 	 * Removes a polynomial from the first elimination level where it occurs and possibly from the list of scheduled polynomials.
 	 * Moreover, all elimination levels are safely cleaned of all elimination polynomials stemming from p.
@@ -410,6 +494,20 @@ public:
 			const Interval<Number>& bounds = Interval<Number>::unboundedInterval()
 	);
 
+	/**
+	 * Computes the real roots of <code>p</code> over the given assignment.
+	 * If <code>p</code> vanishes identically over the assignment and the Lazard projection is used, the roots of its Lazard evaluation are returned.
+	 * @param p univariate polynomial whose coefficient variables are assigned in m
+	 * @param m sample components of all previous levels
+	 * @param bounds only roots within these bounds are computed
+	 * @return the real roots, or boost::none if <code>p</code> vanishes identically
+	 */
+	boost::optional<std::vector<RealAlgebraicNumber<Number>>> liftingRoots(
+			const UPolynomial& p,
+			const std::map<Variable, RealAlgebraicNumber<Number>>& m,
+			const Interval<Number>& bounds
+	) const;
+
 	/**
 	* Computes a variable order from the given range of variables [firstVariable, lastVariable[
 	* based on a Greedy algorithm (see below) working on the given range of polynomials [firstPolynomial, lastPolynomial[.
@@ -445,6 +543,26 @@ private:
 	// AUXILIARY METHODS //
 	///////////////////////
 	
+	/**
+	 * Copies the elimination sets and the polynomials to the last checkpoint, unless they were copied already.
+	 * Must be called before the elimination sets or the polynomials are changed.
+	 */
+	void saveElimination() {
+		if (mTrail.empty() || mTrail.back().eliminationSets) return;
+		mTrail.back().eliminationSets = this->eliminationSets;
+		mTrail.back().polynomials = this->polynomials.snapshot();
+	}
+	/**
+	 * Records a change of the sample tree for the last checkpoint.
+	 * @param kind kind of change
+	 * @param node changed node
+	 * @param sample former sample of a replaced node
+	 */
+	void recordSampleChange(typename SampleChange::Kind kind, sampleIterator node, boost::optional<RealAlgebraicNumber<Number>> sample = boost::none) {
+		if (mTrail.empty()) return;
+		mTrail.back().sampleChanges.push_back(SampleChange({kind, node, std::move(sample)}));
+	}
+
 	bool integerHeuristicActive(cad::IntegerHandling heuristic, std::size_t variable) const {
 		if (this->setting.integerHandling != heuristic) return false;
 		return mVariables[variable].getType() == VariableType::VT_INT;
@@ -582,6 +700,50 @@ public:
 			std::stack<std::size_t>& satPath
 	);
 	
+	/**
+	 * Computes all samples for the given level, using all polynomials of the respective elimination set.
+	 * The method does not use the sample tree and can hence be called concurrently.
+	 * @param openVariableCount level of the samples
+	 * @param assignment sample components of all previous levels
+	 * @return all samples of this level
+	 */
+	cad::SampleSet<Number> liftingSamples(std::size_t openVariableCount, const std::map<Variable, RealAlgebraicNumber<Number>>& assignment);
+
+	/**
+	 * Lifts the given node of a private sample tree whose root is a sample of the base level.
+	 * This is the worker of parallelLiftCheck(). It stops as soon as found or one of the interrupt flags is set.
+	 * @param tree private sample tree
+	 * @param node node to be lifted
+	 * @param openVariableCount number of variables still to be substituted
+	 * @param found flag that is set if any thread found a satisfying sample
+	 * @param r contains the satisfying sample if the result is true
+	 * @param conflictGraph private conflict graph
+	 * @param stats statistics of the current thread
+	 * @return True if a satisfying sample was found, Unknown if the lifting was stopped, False otherwise.
+	 */
+	cad::Answer liftSubtree(
+			Tree& tree,
+			sampleIterator node,
+			std::size_t openVariableCount,
+			const std::atomic_bool& found,
+			RealAlgebraicPoint<Number>& r,
+			cad::ConflictGraph<Number>& conflictGraph,
+			cad::LiftingStatistics& stats
+	);
+
+	/**
+	 * Performs the complete elimination and lifts the samples of the base level concurrently using setting.liftingThreads threads.
+	 * Every sample of the base level is lifted into a private sample tree, which is merged into the sample tree afterwards.
+	 * The lifting stops as soon as a satisfying sample is found or one of the interrupt flags is set.
+	 * @param r RealAlgebraicPoint which contains the satisfying sample point if the check results true
+	 * @param conflictGraph This is a conflict graph. See CAD::check for a full description.
+	 * @return True if a satisfying sample was found or the check was interrupted, False otherwise.
+	 */
+	cad::Answer parallelLiftCheck(
+			RealAlgebraicPoint<Number>& r,
+			cad::ConflictGraph<Number>& conflictGraph
+	);
+	
 	/**
 	 * If eliminationSets[level].emptyLiftingQueue() is true,
 	 * perform elimination steps so that eliminationSets[level] or eliminationSets[l] for any l smaller than level
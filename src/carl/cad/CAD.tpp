@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <forward_list>
 #include <fstream>
+#include <thread>
 #include <vector>
 
 #include "CAD.h"
@@ -16,6 +18,7 @@
 #include "../interval/IntervalEvaluation.h"
 #include "../formula/model/ran/RealAlgebraicNumberSettings.h"
 #include "../core/rootfinder/RootFinder.h"
+#include "../core/polynomialfunctions/LazardEvaluation.h"
 #include "../thom/ThomRootFinder.h"
 #include "../core/polynomialfunctions/SquareFreePart.h"
 
@@ -206,6 +209,7 @@ bool CAD<Number>::prepareElimination() {
 	if (mVariables.newEmpty() && (!polynomials.hasScheduled() || mVariables.empty())) {
 		return false;
 	}
+	this->saveElimination();
 
 	std::size_t newVariableCount = mVariables.newSize();
 
@@ -268,6 +272,7 @@ bool CAD<Number>::prepareElimination() {
 
 template<typename Number>
 void CAD<Number>::clearElimination() {
+	this->saveElimination();
 	this->iscomplete = false;
 	this->eliminationSets.front().clear();
 
@@ -282,6 +287,7 @@ void CAD<Number>::completeElimination(const typename CAD<Number>::BoundMap& boun
 template<typename Number>
 void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
 #endif
+	this->saveElimination();
 	this->prepareElimination();
 	bool useBounds = !bounds.empty();
 	for (const auto& b: bounds) {
@@ -334,13 +340,21 @@ void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
 					this->eliminationSets[l-1].erase(p);
 				}
 			}
+			// both paths queue the new polynomials for single elimination, such that they are checked against the bounds on the next level
+			if (this->setting.projectionThreads > 1) {
+				this->eliminationSets[l-1].eliminateAllInto(this->eliminationSets[l], mVariables[l], this->setting, false, [this](){ return this->anAnswerFound(); });
+			}
 			while (!this->eliminationSets[l-1].emptyPairedEliminationQueue()) {
-				this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting);
+				this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting, false);
 			}
 		}
 	} else {
 		// unbounded elimination from level l-1 to level l
 		for (unsigned l = 1; l < this->eliminationSets.size(); l++) {
+			if (this->setting.projectionThreads > 1) {
+				// compute the whole level in parallel, the remaining polynomials are only left if the computation was interrupted
+				this->eliminationSets[l-1].eliminateAllInto(this->eliminationSets[l], mVariables[l], this->setting, false, [this](){ return this->anAnswerFound(); });
+			}
 			while (	!this->eliminationSets[l-1].emptySingleEliminationQueue() ||
 					!this->eliminationSets[l-1].emptyPairedEliminationQueue()) {
 				this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting, false);
@@ -361,6 +375,7 @@ void CAD<Number>::clear() {
 	this->iscomplete = false;
 	this->interrupted = false;
 	this->interrupts.clear();
+	this->mTrail.clear();
 	this->checkCallCount = 0;
 }
 
@@ -408,6 +423,7 @@ cad::Answer CAD<Number>::check(
 	bool checkBounds)
 {
 	assert(this->sampleTree.isConsistent());
+	this->saveElimination();
 	this->prepareElimination();
 	assert(this->sampleTree.isConsistent());
 	mConstraints.set(_constraints, mVariables);
@@ -599,6 +615,110 @@ cad::Answer CAD<Number>::check(
 	return satisfiable;
 }
 
+template<typename Number>
+std::vector<cad::CellBound<Number>> CAD<Number>::constructCell(const RealAlgebraicPoint<Number>& point) {
+	using MR = MultivariateRoot<MPolynomial>;
+	/// A root of a polynomial over the current sub-point.
+	struct Bound {
+		const UPolynomial* p;
+		std::size_t index;
+		RealAlgebraicNumber<Number> root;
+	};
+	this->prepareElimination();
+	assert(point.dim() == mVariables.size());
+	std::vector<cad::CellBound<Number>> res;
+	if (mVariables.empty()) return res;
+
+	// The polynomials of the cell are owned locally, only the input polynomials are shared with this cad.
+	cad::PolynomialOwner<Number> owner;
+	cad::EliminationSet<Number> current(&owner, typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order), typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order));
+	current.insert(this->eliminationSets.front());
+	cad::ProjectionOperator<const UPolynomial*> projection;
+	auto toRootPolynomial = [](const UPolynomial* p){ return MPolynomial(p->replaceVariable(MR::uniqRootVar())); };
+
+	for (std::size_t l = 0; l < mVariables.size(); l++) {
+		Variable variable = mVariables[l];
+		std::map<Variable, RealAlgebraicNumber<Number>> m;
+		for (std::size_t i = l + 1; i < mVariables.size(); i++) m.emplace(mVariables[i], point[i]);
+
+		std::vector<const UPolynomial*> polynomials;
+		std::vector<const UPolynomial*> nullified;
+		std::vector<const UPolynomial*> constants;
+		boost::optional<Bound> lower, upper, section;
+		for (const auto& p: current.getPolynomials()) {
+			if (p->isNumber()) continue;
+			if (p->isConstant()) {
+				constants.push_back(p);
+				continue;
+			}
+			auto roots = carl::rootfinder::realRoots(*p, m, Interval<Number>::unboundedInterval(), this->setting.splittingStrategy);
+			if (!roots) {
+				CARL_LOG_DEBUG("carl.cad", *p << " vanishes on " << m);
+				nullified.push_back(p);
+				continue;
+			}
+			polynomials.push_back(p);
+			for (std::size_t k = 0; k < roots->size(); k++) {
+				const auto& root = (*roots)[k];
+				if (root == point[l]) {
+					if (!section) section = Bound{p, k + 1, root};
+				} else if (root < point[l]) {
+					if (!lower || lower->root < root) lower = Bound{p, k + 1, root};
+				} else {
+					if (!upper || root < upper->root) upper = Bound{p, k + 1, root};
+				}
+			}
+		}
+		std::vector<const UPolynomial*> defining;
+		if (section) {
+			res.push_back(cad::CellBound<Number>{variable, Relation::EQ, MR(toRootPolynomial(section->p), section->index)});
+			defining.push_back(section->p);
+		} else {
+			if (lower) {
+				res.push_back(cad::CellBound<Number>{variable, Relation::GREATER, MR(toRootPolynomial(lower->p), lower->index)});
+				defining.push_back(lower->p);
+			}
+			if (upper) {
+				res.push_back(cad::CellBound<Number>{variable, Relation::LESS, MR(toRootPolynomial(upper->p), upper->index)});
+				if (!lower || lower->p != upper->p) defining.push_back(upper->p);
+			}
+		}
+		CARL_LOG_DEBUG("carl.cad", "Cell bounds for " << variable << " from " << polynomials.size() << " polynomials, " << defining.size() << " of them define the cell");
+		if (l + 1 == mVariables.size()) break;
+
+		// Project the polynomials relevant for this cell to the next level.
+		Variable next = mVariables[l + 1];
+		cad::EliminationSet<Number> projected(&owner, typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order), typename cad::EliminationSet<Number>::PolynomialComparator(this->setting.order));
+		for (const auto& p: constants) {
+			projected.insert(p->switchVariable(next), {p});
+		}
+		for (const auto& p: nullified) {
+			// The cell is restricted to where all coefficients vanish.
+			for (const auto& coeff: p->coefficients()) {
+				if (coeff.isConstant()) continue;
+				projected.insert(coeff.toUnivariatePolynomial(next), {p});
+			}
+		}
+		for (const auto& p: polynomials) {
+			projection(this->setting.projectionType, p, next, projected);
+			if (std::find(defining.begin(), defining.end(), p) != defining.end()) continue;
+			for (const auto& q: defining) {
+				projection(this->setting.projectionType, q, p, next, projected);
+			}
+		}
+		// Every pair of defining polynomials is projected once, in the order they define the cell.
+		for (std::size_t i = 0; i < defining.size(); i++) {
+			for (std::size_t j = i + 1; j < defining.size(); j++) {
+				projection(this->setting.projectionType, defining[i], defining[j], next, projected);
+			}
+		}
+		projected.makePrimitive();
+		projected.makeSquarefree();
+		current = std::move(projected);
+	}
+	return res;
+}
+
 template<typename Number>
 void CAD<Number>::addPolynomial(const MPolynomial& p, const std::vector<Variable>& v) {
 	CARL_LOG_TRACE("carl.cad", __func__ << "( " << p << ", " << v << " )");
@@ -620,15 +740,54 @@ void CAD<Number>::addPolynomial(const MPolynomial& p, const std::vector<Variable
 		}
 	}
 	// schedule the polynomial for the next elimination
+	this->saveElimination();
 	this->polynomials.schedule(p, up);
 
 	// determine the variables differing from mVariables and add them to the front of the existing variables
 	mVariables.complete(v);
 }
 
+template<typename Number>
+std::size_t CAD<Number>::checkpoint() {
+	CARL_LOG_TRACE("carl.cad", __func__ << "()");
+	mTrail.push_back(Checkpoint({mVariables, mConstraints, iscomplete, {}, boost::none, boost::none}));
+	return mTrail.size();
+}
+
+template<typename Number>
+void CAD<Number>::rollback() {
+	CARL_LOG_TRACE("carl.cad", __func__ << "() to checkpoint " << mTrail.size());
+	assert(!mTrail.empty());
+	Checkpoint& c = mTrail.back();
+	mVariables = std::move(c.variables);
+	for (auto it = c.sampleChanges.rbegin(); it != c.sampleChanges.rend(); ++it) {
+		switch (it->kind) {
+			case SampleChange::Kind::INSERTED:
+				assert(this->sampleTree.is_leaf(it->node));
+				this->sampleTree.erase(it->node);
+				break;
+			case SampleChange::Kind::REPLACED:
+				this->sampleTree.replace(it->node, *it->sample);
+				break;
+			case SampleChange::Kind::DETACHED:
+				this->sampleTree.reattach(it->node);
+				break;
+		}
+	}
+	if (c.eliminationSets) {
+		eliminationSets = std::move(*c.eliminationSets);
+		polynomials.restore(*c.polynomials);
+	}
+	mConstraints = std::move(c.constraints);
+	iscomplete = c.iscomplete;
+	mTrail.pop_back();
+	assert(this->sampleTree.isConsistent());
+}
+
 template<typename Number>
 void CAD<Number>::removePolynomial(const MPolynomial& polynomial) {
 	CARL_LOG_TRACE("carl.cad", __func__ << "( " << polynomial << " )");
+	this->saveElimination();
 
 	auto up = polynomials.removePolynomial(polynomial);
 	if (up == nullptr) return;
@@ -651,6 +810,7 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 	// no equivalent polynomial for p in any level
 	if (p == nullptr) return;
 	CARL_LOG_FUNC("carl.cad", *p << ", " << level << ", " << childrenOnly);
+	this->saveElimination();
 	assert(this->isSampleTreeConsistent());
 	assert(this->sampleTree.isConsistent());
 
@@ -697,7 +857,13 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 			if (depth <= maxDepth) {
 				// erase all samples on this level
 				for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); ) {
-					node = this->sampleTree.erase(node);
+					if (mTrail.empty()) {
+						node = this->sampleTree.erase(node);
+					} else {
+						// keep the samples such that rollback() can restore them
+						this->recordSampleChange(SampleChange::Kind::DETACHED, sampleIterator(node));
+						node = this->sampleTree.detach(node);
+					}
 				}
 				maxDepth = depth-1;
 			}
@@ -841,7 +1007,7 @@ cad::SampleSet<Number> CAD<Number>::samples(
 		valit++;
 	}
 	CARL_LOG_FUNC("carl.cad", *p << " on " << m);
-	auto roots = carl::rootfinder::realRoots(*p, m, bounds, this->setting.splittingStrategy);
+	auto roots = this->liftingRoots(*p, m, bounds);
 	if (roots) {
 		return this->samples(
 			openVariableCount,
@@ -863,6 +1029,24 @@ cad::SampleSet<Number> CAD<Number>::samples(
 	}
 }
 
+template<typename Number>
+boost::optional<std::vector<RealAlgebraicNumber<Number>>> CAD<Number>::liftingRoots(
+		const UPolynomial& p,
+		const std::map<Variable, RealAlgebraicNumber<Number>>& m,
+		const Interval<Number>& bounds
+) const {
+	auto roots = carl::rootfinder::realRoots(p, m, bounds, this->setting.splittingStrategy);
+	if (roots || this->setting.projectionType != cad::ProjectionType::Lazard) return roots;
+	// The variables are assigned starting with the last one.
+	std::vector<Variable> order;
+	for (auto v = mVariables.rbegin(); v != mVariables.rend(); v++) {
+		if (m.find(*v) != m.end()) order.push_back(*v);
+	}
+	UPolynomial q = carl::lazardEvaluation(p, order, m);
+	CARL_LOG_DEBUG("carl.cad", p << " vanishes on " << m << ", using Lazard evaluation " << q);
+	return carl::rootfinder::realRoots(q, m, bounds, this->setting.splittingStrategy);
+}
+
 template<typename Number>
 template<class VariableIterator, class PolynomialIterator>
 std::vector<Variable> CAD<Number>::orderVariablesGreedily(
@@ -909,6 +1093,11 @@ std::vector<Variable> CAD<Number>::orderVariablesGreedily(
 
 template<typename Number>
 void CAD<Number>::alterSetting(const cad::CADSettings& _setting) {
+	if (_setting.order != this->setting.order ||
+		(!this->setting.simplifyByRootcounting && _setting.simplifyByRootcounting) ||
+		(!this->setting.simplifyByFactorization && _setting.simplifyByFactorization)) {
+		this->saveElimination();
+	}
 	// settings that require re-computation
 	if (_setting.order != this->setting.order) {
 		// switch the order relation in all elimination sets
@@ -1099,6 +1288,10 @@ cad::Answer CAD<Number>::mainCheck(
 	 */
 	CARL_LOG_TRACE("carl.cad", __func__ << ": Phase 2");
 	CARL_LOG_TRACE("carl.cad", *this);
+	if (maxDepth == 0 && this->setting.liftingThreads > 1 && !boundsNontrivial) {
+		CARL_LOG_TRACE("carl.cad", "maxDepth == 0, lifting in parallel");
+		return this->parallelLiftCheck(r, conflictGraph);
+	}
 	if (maxDepth == 0) {
 		CARL_LOG_TRACE("carl.cad", "maxDepth == 0");
 		// there is no sample component computed yet, so we are at the base level
@@ -1302,12 +1495,15 @@ typename CAD<Number>::sampleIterator CAD<Number>::storeSampleInTree(RealAlgebrai
 	auto newNode = std::lower_bound(this->sampleTree.begin_children(node), this->sampleTree.end_children(node), newSample);
 	if (newNode == this->sampleTree.end_children(node)) {
 		newNode = this->sampleTree.append(node, newSample);
+		this->recordSampleChange(SampleChange::Kind::INSERTED, newNode);
 	} else if (*newNode == newSample) {
 		assert(newSample.isRoot() || (!newNode->isRoot()));
+		this->recordSampleChange(SampleChange::Kind::REPLACED, newNode, *newNode);
 		newNode = this->sampleTree.replace(newNode, newSample);
 		assert(newNode.depth() <= mVariables.size());
 	} else {
 		newNode = this->sampleTree.insert(newNode, newSample);
+		this->recordSampleChange(SampleChange::Kind::INSERTED, newNode);
 		assert(newNode.depth() <= mVariables.size());
 	}
 	assert(this->sampleTree.isConsistent());
@@ -1636,8 +1832,172 @@ cad::Answer CAD<Number>::liftCheck(
 	return cad::Answer::False;
 }
 
+template<typename Number>
+cad::SampleSet<Number> CAD<Number>::liftingSamples(std::size_t openVariableCount, const std::map<Variable, RealAlgebraicNumber<Number>>& assignment) {
+	cad::SampleSet<Number> currentSamples(setting.sampleOrdering);
+	std::forward_list<RealAlgebraicNumber<Number>> replacedSamples;
+	// fill in a standard sample to ensure that every level has samples, as done in liftCheck
+	this->samples(openVariableCount, {RealAlgebraicNumber<Number>(0, true)}, currentSamples, replacedSamples);
+	for (const auto& p: this->eliminationSets[openVariableCount].getPolynomials()) {
+		auto roots = this->liftingRoots(*p, assignment, Interval<Number>::unboundedInterval());
+		// if p vanishes, zero is already a sample
+		if (!roots) continue;
+		this->samples(openVariableCount, std::list<RealAlgebraicNumber<Number>>(roots->begin(), roots->end()), currentSamples, replacedSamples);
+	}
+	return currentSamples;
+}
+
+template<typename Number>
+cad::Answer CAD<Number>::liftSubtree(
+		Tree& tree,
+		sampleIterator node,
+		std::size_t openVariableCount,
+		const std::atomic_bool& found,
+		RealAlgebraicPoint<Number>& r,
+		cad::ConflictGraph<Number>& conflictGraph,
+		cad::LiftingStatistics& stats
+) {
+	if (found.load() || this->anAnswerFound()) return cad::Answer::Unknown;
+
+	if (openVariableCount == 0) {
+		// the private tree has no empty root, hence the whole path is the sample
+		RealAlgebraicPoint<Number> t(std::vector<RealAlgebraicNumber<Number>>(tree.begin_path(node), tree.end_path()));
+		stats.checkedSamples++;
+		if ((this->setting.computeConflictGraph && mConstraints.satisfiedBy(t, getVariables(), conflictGraph)) ||
+			(!this->setting.computeConflictGraph && mConstraints.satisfiedBy(t, getVariables()))) {
+			r = t;
+			return cad::Answer::True;
+		}
+		return cad::Answer::False;
+	}
+	openVariableCount--;
+
+	std::map<Variable, RealAlgebraicNumber<Number>> m;
+	std::size_t i = mVariables.size() - openVariableCount - 1;
+	for (auto it = tree.begin_path(node); it != tree.end_path(); it++) {
+		m[mVariables[mVariables.size() - i]] = *it;
+		i--;
+	}
+	cad::SampleSet<Number> samples = this->liftingSamples(openVariableCount, m);
+	stats.liftedNodes++;
+	stats.samples += samples.samples().size();
+	// store all samples, such that the remaining ones can be lifted later on if we stop early
+	for (const auto& sample: samples.samples()) {
+		tree.append(node, sample);
+	}
+	while (!samples.empty()) {
+		RealAlgebraicNumber<Number> sample = samples.next();
+		samples.pop();
+		if (this->setting.ignoreRoots && sample.isRoot() && !sample.isIntegral()) continue;
+		auto child = std::find(tree.begin_children(node), tree.end_children(node), sample);
+		assert(child != tree.end_children(node));
+		cad::Answer res = this->liftSubtree(tree, sampleIterator(child), openVariableCount, found, r, conflictGraph, stats);
+		if (res != cad::Answer::False) return res;
+	}
+	return cad::Answer::False;
+}
+
+template<typename Number>
+cad::Answer CAD<Number>::parallelLiftCheck(
+		RealAlgebraicPoint<Number>& r,
+		cad::ConflictGraph<Number>& conflictGraph
+) {
+	std::size_t threads = this->setting.liftingThreads;
+#ifndef THREAD_SAFE
+	if (threads > 1) {
+		CARL_LOG_WARN("carl.cad", "Parallel lifting requires THREAD_SAFE, falling back to a single thread.");
+		threads = 1;
+	}
+#endif
+	this->completeElimination();
+	// Terms are ordered lazily, hence we order all polynomials before they are shared among the threads.
+	for (const auto& level: this->eliminationSets) {
+		for (const auto& p: level.getPolynomials()) {
+			for (const auto& c: p->coefficients()) c.makeOrdered();
+		}
+	}
+	for (const auto& c: mConstraints) c.getPolynomial().makeOrdered();
+
+	// the samples of the base level are computed sequentially and stored in the sample tree
+	const std::size_t dim = mVariables.size();
+	cad::SampleSet<Number> baseSamples = this->liftingSamples(dim - 1, {});
+	std::vector<sampleIterator> nodes;
+	std::vector<Tree> subtrees;
+	while (!baseSamples.empty()) {
+		RealAlgebraicNumber<Number> sample = baseSamples.next();
+		baseSamples.pop();
+		auto node = this->storeSampleInTree(sample, this->sampleTree.begin());
+		if (this->setting.ignoreRoots && sample.isRoot() && !sample.isIntegral()) continue;
+		nodes.push_back(node);
+		subtrees.emplace_back();
+		subtrees.back().setRoot(sample);
+	}
+
+	// sibling samples are lifted concurrently, idle threads fetch the next one
+	std::vector<cad::Answer> answers(nodes.size(), cad::Answer::Unknown);
+	std::vector<RealAlgebraicPoint<Number>> points(nodes.size());
+	std::vector<cad::ConflictGraph<Number>> graphs(nodes.size());
+	std::atomic<std::size_t> next(0);
+	std::atomic_bool found(false);
+	threads = std::max(std::size_t(1), std::min(threads, nodes.size()));
+	this->liftingStatistics.assign(threads, cad::LiftingStatistics());
+	auto worker = [&](std::size_t thread) {
+		auto start = std::chrono::steady_clock::now();
+		while (!found.load() && !this->anAnswerFound()) {
+			std::size_t id = next++;
+			if (id >= nodes.size()) break;
+			this->liftingStatistics[thread].subtrees++;
+			answers[id] = this->liftSubtree(subtrees[id], subtrees[id].begin(), dim - 1, found, points[id], graphs[id], this->liftingStatistics[thread]);
+			if (answers[id] == cad::Answer::True) found = true;
+		}
+		this->liftingStatistics[thread].time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	};
+	CARL_LOG_DEBUG("carl.cad", "Lifting " << nodes.size() << " samples using " << threads << " threads");
+	std::vector<std::thread> pool;
+	for (std::size_t t = 1; t < threads; t++) pool.emplace_back(worker, t);
+	worker(0);
+	for (auto& t: pool) t.join();
+	for (std::size_t t = 0; t < threads; t++) {
+		CARL_LOG_DEBUG("carl.cad", "Thread " << t << ": " << this->liftingStatistics[t]);
+	}
+
+	// merge the private subtrees in the order of the samples, unlifted samples remain leaves
+	for (std::size_t id = 0; id < nodes.size(); id++) {
+		std::vector<std::pair<sampleIterator, sampleIterator>> queue({ std::make_pair(subtrees[id].begin(), nodes[id]) });
+		while (!queue.empty()) {
+			auto cur = queue.back();
+			queue.pop_back();
+			for (auto child = subtrees[id].begin_children(cur.first); child != subtrees[id].end_children(cur.first); child++) {
+				queue.emplace_back(sampleIterator(child), this->sampleTree.append(cur.second, *child));
+				this->recordSampleChange(SampleChange::Kind::INSERTED, queue.back().second);
+			}
+		}
+		conflictGraph.merge(graphs[id]);
+	}
+	assert(this->sampleTree.isConsistent());
+	// all lifting positions were used for the lifted nodes
+	for (auto& level: this->eliminationSets) {
+		while (!level.emptyLiftingQueue()) level.popLiftingPosition();
+		level.setLiftingPositionsReset();
+	}
+
+	for (std::size_t id = 0; id < nodes.size(); id++) {
+		if (answers[id] == cad::Answer::True) {
+			r = points[id];
+			return cad::Answer::True;
+		}
+	}
+	if (this->anAnswerFound()) {
+		this->interrupted = true;
+		return cad::Answer::True;
+	}
+	this->iscomplete = true;
+	return cad::Answer::False;
+}
+
 template<typename Number>
 int CAD<Number>::eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive) {
+	this->saveElimination();
 	CARL_LOG_FUNC("carl.cad.elimination", level << ", " << bounds);
 	while (true) {
 		if (!this->eliminationSets[level].emptyLiftingQueue()) return (int)level;
@@ -1861,6 +2221,7 @@ bool CAD<Number>::vanishesInBox(const UPolynomial* p, const BoundMap& box, std::
 		cadbox.completeElimination();
 		CARL_LOG_TRACE("carl.core", "Back from nested CAD " << &cadbox);
 		if (recuperate) {
+			this->saveElimination();
 			// recuperate eliminated polynomials and go on with the elimination
 			std::size_t k = 0;
 			for (std::size_t i = level + 1; i < mVariables.size(); i++) {
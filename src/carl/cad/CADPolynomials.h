@@ -37,6 +37,16 @@ private:
 	 */
 	std::vector<const UPolynomial*> scheduled;
 public:
+	/**
+	 * The lists of polynomials without the ownership of the polynomials.
+	 * The polynomials are owned until this object is destroyed, hence a snapshot stays valid.
+	 */
+	struct Snapshot {
+		std::list<const UPolynomial*> polynomials;
+		std::unordered_map<const MPolynomial, const UPolynomial*, std::hash<MPolynomial>> map;
+		std::vector<const UPolynomial*> scheduled;
+	};
+
 	CADPolynomials(): cad::PolynomialOwner<Number>() {}
 	CADPolynomials(cad::PolynomialOwner<Number>* parent): cad::PolynomialOwner<Number>(parent) {}
 	
@@ -96,6 +106,15 @@ public:
 	void clear() {
 		polynomials.clear();
 	}
+
+	Snapshot snapshot() const {
+		return Snapshot({polynomials, map, scheduled});
+	}
+	void restore(const Snapshot& s) {
+		polynomials = s.polynomials;
+		map = s.map;
+		scheduled = s.scheduled;
+	}
 };
 
 template<typename Number>
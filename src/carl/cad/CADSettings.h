@@ -11,6 +11,7 @@
 #include "../core/logging.h"
 #include "../core/carlLogging.h"
 #include "../core/rootfinder/RootFinder.h"
+#include "Projection.h"
 
 namespace carl {
 namespace cad {
@@ -150,6 +151,12 @@ public:
 	PolynomialComparisonOrder order;
 	/// standard strategy to be used for real root isolation
 	rootfinder::SplittingStrategy splittingStrategy;
+	/// projection operator, the Lazard projection also enables the Lazard evaluation for nullified polynomials during lifting
+	ProjectionType projectionType;
+	/// number of threads used to compute the projection of a level, 1 disables the parallel projection
+	std::size_t projectionThreads;
+	/// number of threads used to lift the samples of the base level, 1 disables the parallel lifting
+	std::size_t liftingThreads;
 
 	/**
 	 * Generate a CADSettings instance of the respective preset type.
@@ -231,7 +238,7 @@ public:
 		if (settings.simplifyByRootcounting)
 			settingStrs.push_back( "Simplify the base elimination level by real root counting." );
 		if (settings.simplifyByFactorization)
-			settingStrs.push_back( "Simplify the elimination by factorization of polynomials in every level (using GiNaC::factor)." );
+			settingStrs.push_back( "Simplify the elimination by factorization of polynomials in every level." );
 		if (settings.equationsOnly)
 			settingStrs.push_back( "Simplify elimination for equation-only use (currently disabled) + do not use intermediate points for lifting." );
 		if (settings.inequalitiesOnly)
@@ -258,6 +265,14 @@ public:
 			settingStrs.push_back( orderStr + "Take polynomial with small degree first." );
 		if (settings.order == PolynomialComparisonOrder::Memory)
 			settingStrs.push_back( orderStr + "Take polynomial with small memory address first." );
+		if (settings.projectionType == ProjectionType::McCallum)
+			settingStrs.push_back( "Use McCallum's projection operator." );
+		if (settings.projectionType == ProjectionType::Lazard)
+			settingStrs.push_back( "Use Lazard's projection operator and lift nullified polynomials by their Lazard evaluation." );
+		if (settings.projectionThreads > 1)
+			settingStrs.push_back( "Compute the projection of each level using " + std::to_string(settings.projectionThreads) + " threads." );
+		if (settings.liftingThreads > 1)
+			settingStrs.push_back( "Lift the samples of the base level using " + std::to_string(settings.liftingThreads) + " threads." );
 
 		os << "+------------------------------------ CAD Setting -----------------------------------";
 		if (settingStrs.empty()) {
@@ -293,7 +308,10 @@ private:
 		ignoreRoots(false),
 		integerHandling(IntegerHandling::SPLIT_ASSIGNMENT),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionType(ProjectionType::Brown),
+		projectionThreads(1),
+		liftingThreads(1)
 	{}
 
 public:
@@ -319,7 +337,10 @@ public:
 		ignoreRoots(s.ignoreRoots),
 		integerHandling(s.integerHandling),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionType(s.projectionType),
+		projectionThreads(s.projectionThreads),
+		liftingThreads(s.liftingThreads)
 	{}
 };
 
@@ -6,11 +6,15 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <ostream>
 
 #include "../core/MultivariatePolynomial.h"
 #include "../core/UnivariatePolynomial.h"
 #include "../core/logging.h"
+#include "../core/Relation.h"
+#include "../formula/model/mvroot/MultivariateRoot.h"
 
 namespace carl {
 namespace cad {
@@ -18,12 +22,51 @@ using carl::operator<<;
 
 enum Answer { True = 0, False = 1, Unknown = 2 };
 
+/**
+ * Statistics of a single thread of the parallel lifting.
+ */
+struct LiftingStatistics {
+	/// number of base level samples whose subtree was lifted
+	std::size_t subtrees = 0;
+	/// number of sample tree nodes that were lifted
+	std::size_t liftedNodes = 0;
+	/// number of samples constructed
+	std::size_t samples = 0;
+	/// number of full dimensional samples checked against the constraints
+	std::size_t checkedSamples = 0;
+	/// time spent lifting
+	std::chrono::microseconds time = std::chrono::microseconds(0);
+};
+
+inline std::ostream& operator<<(std::ostream& os, const LiftingStatistics& s) {
+	return os << s.subtrees << " subtrees, " << s.liftedNodes << " lifted nodes, " << s.samples << " samples, " << s.checkedSamples << " checked samples in " << s.time.count() << "us";
+}
+
 template<typename Coeff>
 using MPolynomial = carl::MultivariatePolynomial<Coeff>;
 
 template<typename Coeff>
 using UPolynomial = carl::UnivariatePolynomial<MPolynomial<Coeff>>;
 
+/**
+ * A bound of a single cell, comparing a variable with a root of a polynomial over the values of the remaining variables.
+ * Constraints in the sense of VariableComparison can be obtained directly from these members.
+ */
+template<typename Coeff>
+struct CellBound {
+	/// the bounded variable
+	Variable variable;
+	/// EQ for sections, GREATER for lower and LESS for upper bounds
+	Relation relation;
+	/// the root bounding the variable
+	MultivariateRoot<MPolynomial<Coeff>> root;
+};
+
+template<typename Coeff>
+inline std::ostream& operator<<(std::ostream& os, const CellBound<Coeff>& b) {
+	return os << b.variable << " " << b.relation << " " << b.root;
+}
+
 /**
  * This class manages the ownership of pointers to UnivariatePolynomial objects.
  * It is intended to be subclassed, for example by the CAD class.
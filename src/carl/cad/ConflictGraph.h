@@ -105,6 +105,20 @@ public:
 		CARL_LOG_TRACE("carl.cad.cg", "Set " << constraint << " / " << sample << " to " << value);
 		mData[constraint][sample] = value;
 	}
+	/**
+	 * Adds all samples of the given graph as new samples to this graph.
+	 */
+	void merge(const ConflictGraph& g) {
+		for (const auto& it: g.mConstraints) {
+			std::size_t id = getConstraint(it.first);
+			if (it.second >= g.mData.size()) continue;
+			const auto& data = g.mData[it.second];
+			for (std::size_t i = data.find_first(); i != boost::dynamic_bitset<>::npos; i = data.find_next(i)) {
+				set(id, mSampleCount + i, true);
+			}
+		}
+		mSampleCount += g.mSampleCount;
+	}
 	/**
 	 * Retrieves the constraint that covers the most samples.
 	 */
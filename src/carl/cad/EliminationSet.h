@@ -7,6 +7,7 @@
 #pragma once
 
 #include <forward_list>
+#include <functional>
 #include <list>
 #include <memory>
 #include <set>
@@ -139,12 +140,28 @@ private:
 	 */
 	PolynomialComparator liftingOrder;
 
-	ProjectionType projectionType = ProjectionType::Brown;
 	ProjectionOperator<const UPolynomial*> projection;
 	template<typename... Args>
-	void project(Args&&... args) const {
-		projection(projectionType, std::forward<Args>(args)...);
+	void project(const CADSettings& setting, Args&&... args) const {
+		projection(setting.projectionType, std::forward<Args>(args)...);
 	}
+	/**
+	 * Computes the given projections using setting.projectionThreads threads and inserts the results into destination.
+	 * The results are inserted in the order of the tasks, independent of the order in which they were computed.
+	 * @param tasks Pairs of polynomials to project, the second entry is nullptr for single projections.
+	 * @param variable the main variable of the destination elimination set
+	 * @param setting
+	 * @param destination
+	 * @param interrupted Indicates whether the computation should be stopped.
+	 * @return Number of finished tasks, these are the first ones.
+	 */
+	std::size_t projectInto(
+			const std::vector<PolynomialPair>& tasks,
+			Variable::Arg variable,
+			const CADSettings& setting,
+			EliminationSet<Coefficient>& destination,
+			const std::function<bool()>& interrupted = nullptr
+			) const;
 
 	/**
 	 * Elimination queue containing all polynomials not yet considered for non-paired elimination.
@@ -529,6 +546,28 @@ public:
 			bool synchronous = false
 			);
 
+	/**
+	 * Does the elimination of all polynomials in the elimination queues and stores the resulting polynomials into the specified
+	 * destination set.
+	 *
+	 * The result is the same as calling eliminateNextInto() until both queues are empty, but the projections are computed using
+	 * setting.projectionThreads threads.
+	 * If the computation is interrupted, all polynomials whose projections were not finished remain in the elimination queues.
+	 * @param destination
+	 * @param variable the main variable of the destination elimination set
+	 * @param setting special settings for simplifications etc.
+	 * @param avoidSingle If true, the polynomials added are not added to the single-elimination queue of destination (default: false).
+	 * @param interrupted Indicates whether the computation should be stopped.
+	 * @return list of polynomials added to destination
+	 */
+	std::list<const UPolynomial*> eliminateAllInto(
+			EliminationSet<Coefficient>& destination,
+			Variable::Arg variable,
+			const CADSettings& setting,
+			bool avoidSingle = false,
+			const std::function<bool()>& interrupted = nullptr
+			);
+
 
 	
 	////////////////
@@ -567,8 +606,7 @@ public:
 	void makePrimitive();
 	
 	/**
-	 * Replaces all polynomials by their factors (currently uses GiNaC::factor).
-	 * In order to work properly, GiNaC::factor should receive integer polynomials. Thus, before the factorization, all polynomials are transformed to integral polynomials.
+	 * Replaces all polynomials by their irreducible factors (uses carl::factorization).
 	 * @complexity linear in the number of elements stored in the set
 	 */
 	void factorize();
@@ -6,6 +6,7 @@
 #include "EliminationSet.h"
 #include "CADLogging.h"
 
+#include "../core/polynomialfunctions/Factorization.h"
 #include "../core/polynomialfunctions/SquareFreePart.h"
 
 namespace carl {
@@ -328,37 +329,48 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
 
-	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
-
-	if( setting.equationsOnly ) {
-		// (1) elimination with existing polynomials
+	if (setting.projectionThreads > 1) {
+		std::vector<PolynomialPair> tasks;
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
-			//eliminationEq( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			tasks.emplace_back(p, pol_it1);
 		}
-		// (2) elimination with polynomial itself @todo: proof that we do not need that
-		// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
+		tasks.emplace_back(p, nullptr);
+		this->projectInto(tasks, variable, setting, newEliminationPolynomials);
 	} else {
-		// (1) elimination with existing polynomials
-		for (auto pol_it1: this->polynomials) {
-			assert(p->mainVar() == pol_it1->mainVar());
-			//elimination( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
-		}
-		// (2) elimination with polynomial itself @todo: proof that we do not need that
-		// elimination( p, p, variable, newEliminationPolynomials, setting );
 
-	}
+		// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
 
-	// !PAIRED (single) elimination
+		if( setting.equationsOnly ) {
+			// (1) elimination with existing polynomials
+			for (auto pol_it1: this->polynomials) {
+				assert(p->mainVar() == pol_it1->mainVar());
+				//eliminationEq( p, pol_it1, variable, newEliminationPolynomials, false );
+				project(setting, p, pol_it1, variable, newEliminationPolynomials);
+			}
+			// (2) elimination with polynomial itself @todo: proof that we do not need that
+			// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
+		} else {
+			// (1) elimination with existing polynomials
+			for (auto pol_it1: this->polynomials) {
+				assert(p->mainVar() == pol_it1->mainVar());
+				//elimination( p, pol_it1, variable, newEliminationPolynomials, false );
+				project(setting, p, pol_it1, variable, newEliminationPolynomials);
+			}
+			// (2) elimination with polynomial itself @todo: proof that we do not need that
+			// elimination( p, p, variable, newEliminationPolynomials, setting );
 
-	if( setting.equationsOnly ) {
-		//eliminationEq( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
-	} else {
-		//elimination( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		}
+
+		// !PAIRED (single) elimination
+
+		if( setting.equationsOnly ) {
+			//eliminationEq( p, variable, newEliminationPolynomials, false );
+			project(setting, p, variable, newEliminationPolynomials);
+		} else {
+			//elimination( p, variable, newEliminationPolynomials, false );
+			project(setting, p, variable, newEliminationPolynomials);
+		}
 	}
 
 
@@ -433,17 +445,22 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
 
 	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
-	if (!mPairedEliminationQueue.empty()) {
+	if (!mPairedEliminationQueue.empty() && setting.projectionThreads > 1) {
+		std::vector<PolynomialPair> tasks;
+		for (auto pol_it1: this->polynomials) tasks.emplace_back(p, pol_it1);
+		this->projectInto(tasks, variable, setting, newEliminationPolynomials);
+		mPairedEliminationQueue.pop_front();
+	} else if (!mPairedEliminationQueue.empty()) {
 		if( setting.equationsOnly ) {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				project( setting, p, pol_it1, variable, newEliminationPolynomials);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
 		} else {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				project( setting, p, pol_it1, variable, newEliminationPolynomials);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// elimination( p, p, variable, newEliminationPolynomials, setting );
 		}
@@ -456,9 +473,9 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	{
 		p = mSingleEliminationQueue.front();
 		if (setting.equationsOnly) {
-			project( p, variable, newEliminationPolynomials );
+			project( setting, p, variable, newEliminationPolynomials );
 		} else {
-			project( p, variable, newEliminationPolynomials );
+			project( setting, p, variable, newEliminationPolynomials );
 		}
 		mSingleEliminationQueue.pop_front();
 	}
@@ -474,6 +491,95 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	return destination.insert( newEliminationPolynomials, avoidSingle );
 }
 
+template<typename Coefficient>
+std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateAllInto(
+		EliminationSet<Coefficient>& destination,
+		Variable::Arg variable,
+		const CADSettings& setting,
+		bool avoidSingle,
+		const std::function<bool()>& interrupted
+		)
+{
+	std::list<const UPolynomial*> res;
+	// constants are not projected but moved to the destination, as done by eliminateConstant
+	std::vector<const UPolynomial*> constants;
+	for (auto p: mPairedEliminationQueue) {
+		if (p->isConstant()) constants.push_back(p);
+	}
+	for (auto p: mSingleEliminationQueue) {
+		if (p->isConstant() && std::find(constants.begin(), constants.end(), p) == constants.end()) constants.push_back(p);
+	}
+	for (auto p: constants) {
+		if (p->isNumber()) { /* discard numerics completely */
+			DOT_NODE("elimination", p, "shape=box");
+			this->erase(p);
+			continue;
+		}
+		const UPolynomial* pNewVar = this->polynomialOwner->take(new UPolynomial(p->switchVariable(variable)));
+		destination.insert(pNewVar, this->getParentsOf(p), avoidSingle);
+		if( setting.removeConstants ) { /* remove constant from this level */
+			DOT_NODE("elimination", p, "shape=box");
+			this->erase(p);
+		} else {
+			mPairedEliminationQueue.remove(p);
+			mSingleEliminationQueue.remove(p);
+		}
+		DOT_EDGE("elimination", p, pNewVar, "label=\"constant\"");
+		res.push_back(pNewVar);
+	}
+
+	// PAIRED elimination of every queued polynomial with all polynomials, followed by the !PAIRED (single) elimination
+	std::vector<PolynomialPair> tasks;
+	for (auto p: mPairedEliminationQueue) {
+		for (auto pol_it1: this->polynomials) tasks.emplace_back(p, pol_it1);
+	}
+	std::size_t pairedTasks = tasks.size();
+	for (auto p: mSingleEliminationQueue) {
+		tasks.emplace_back(p, nullptr);
+	}
+	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::size_t finished = this->projectInto(tasks, variable, setting, newEliminationPolynomials, interrupted);
+	// pop all polynomials whose projections are finished
+	if (pairedTasks > 0) {
+		std::size_t paired = std::min(finished, pairedTasks) / this->polynomials.size();
+		for (std::size_t i = 0; i < paired; i++) mPairedEliminationQueue.pop_front();
+	}
+	for (std::size_t i = pairedTasks; i < finished; i++) mSingleEliminationQueue.pop_front();
+	if (finished < tasks.size()) {
+		CARL_LOG_DEBUG("carl.cad.elimination", "Interrupted after " << finished << " of " << tasks.size() << " projections");
+	}
+
+	// optimizations
+	if( setting.simplifyByFactorization )
+		newEliminationPolynomials.factorize();
+	newEliminationPolynomials.makePrimitive();
+	newEliminationPolynomials.makeSquarefree();
+	if( setting.simplifyByRootcounting )
+		newEliminationPolynomials.removePolynomialsWithoutRealRoots();
+	// insert the new polynomials into the next level
+	res.splice(res.end(), destination.insert( newEliminationPolynomials, avoidSingle ));
+	return res;
+}
+
+template<typename Coefficient>
+std::size_t EliminationSet<Coefficient>::projectInto(
+		const std::vector<PolynomialPair>& tasks,
+		Variable::Arg variable,
+		const CADSettings& setting,
+		EliminationSet<Coefficient>& destination,
+		const std::function<bool()>& interrupted
+		) const
+{
+	std::vector<ProjectionResult<UPolynomial>> results;
+	std::size_t finished = projectParallel(setting.projectionType, tasks, variable, results, setting.projectionThreads, interrupted);
+	for (std::size_t i = 0; i < finished; i++) {
+		for (const auto& r: results[i].polynomials) {
+			destination.insert(r.first, r.second);
+		}
+	}
+	return finished;
+}
+
 template<typename Coefficient>
 void EliminationSet<Coefficient>::moveConstants(EliminationSet<Coefficient>& to, Variable::Arg variable ) {
 	std::forward_list<const UPolynomial*> toDelete;
@@ -563,10 +669,13 @@ void EliminationSet<Coefficient>::factorize() {
 	EliminationSet<Coefficient> factorizedSet(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
 	for (auto p: this->polynomials) {
 		// insert the factors and omit the original
-		// TODO: Perform multivariate factorization here.
-		/*for (auto factor: p->factorization()) {
-			factorizedSet.insert(factor.first, this->getParentsOf(p));
-		}*/
+		if (!p->isNumber()) {
+			// numeric factors are discarded
+			for (const auto& factor: carl::factorization(MPolynomial<Coefficient>(*p), false)) {
+				factorizedSet.insert(factor.first.toUnivariatePolynomial(p->mainVar()), this->getParentsOf(p));
+			}
+			continue;
+		}
 		factorizedSet.insert(p, this->getParentsOf(p));
 	}
 	std::swap(*this, factorizedSet);
@@ -3,22 +3,35 @@
 #include "../core/logging.h"
 #include "../core/Variable.h"
 
-#include "../core/polynomialfunctions/Resultant.h"
+#include "ProjectionCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <type_traits>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace carl {
 namespace cad {
 
     enum class ProjectionType: unsigned {
-        Brown, McCallum, Hong
+        Brown, McCallum, Hong, Lazard
     };
 
     template<typename Poly>
     struct ProjectionOperator {
+		/// Resultants and discriminants are taken from the global ProjectionCache.
+		using Cache = ProjectionCache<typename std::remove_cv<typename std::remove_pointer<Poly>::type>::type>;
+
         template<typename Inserter>
         void operator()(ProjectionType pt, const Poly& p, Variable::Arg variable, Inserter& i) const {
             switch (pt) {
 				case ProjectionType::Brown: return Brown(p, variable, i);
                 case ProjectionType::McCallum: return McCallum(p, variable, i);
+                case ProjectionType::Lazard: return Lazard(p, variable, i);
                 default:
                     CARL_LOG_ERROR("carl.cad", "Selected a projection operator that is not implemented.");
                     return;
@@ -29,6 +42,7 @@ namespace cad {
             switch (pt) {
 				case ProjectionType::Brown: return Brown(p, q, variable, i);
                 case ProjectionType::McCallum: return McCallum(p, q, variable, i);
+                case ProjectionType::Lazard: return Lazard(p, q, variable, i);
                 default:
                     CARL_LOG_ERROR("carl.cad", "Selected a projection operator that is not implemented.");
                     return;
@@ -53,13 +67,13 @@ namespace cad {
 		template<typename Inserter>
 		void Brown(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
 			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
-			i.insert(carl::resultant(*p, *q).switchVariable(variable), {p, q}, false);
+			i.insert(Cache::getInstance().resultant(*p, *q).switchVariable(variable), {p, q}, false);
 		}
 		template<typename Inserter>
 		void Brown(const Poly& p, Variable::Arg variable, Inserter& i) const {
 			// Insert discriminant
 			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
-			i.insert(carl::discriminant(*p).switchVariable(variable), {p}, false);
+			i.insert(Cache::getInstance().discriminant(*p).switchVariable(variable), {p}, false);
 			if (doesNotVanish(p->lcoeff())) {
 				CARL_LOG_DEBUG("carl.cad.projection", "lcoeff = " << p->lcoeff() << " does not vanish. No further polynomials needed.");
 				return;
@@ -81,20 +95,118 @@ namespace cad {
         template<typename Inserter>
         void McCallum(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
 			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
-            i.insert(carl::resultant(*p, *q).switchVariable(variable), {p, q}, false);
+            i.insert(Cache::getInstance().resultant(*p, *q).switchVariable(variable), {p, q}, false);
         }
         template<typename Inserter>
         void McCallum(const Poly& p, Variable::Arg variable, Inserter& i) const {
             // Insert discriminant
 			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
-            i.insert(carl::discriminant(*p).switchVariable(variable), {p}, false);
+            i.insert(Cache::getInstance().discriminant(*p).switchVariable(variable), {p}, false);
             for (const auto& coeff: p->coefficients()) {
 				if (coeff.isConstant()) continue;
 				CARL_LOG_DEBUG("carl.cad.projection", "\t-> " << coeff);
                 i.insert(coeff.toUnivariatePolynomial(variable), {p}, false);
             }
         }
+		/**
+		 * Lazard's projection operator @cite Lazard94 consists of the resultants, the discriminants and the leading and trailing coefficients.
+		 * It is smaller than McCallum's operator and complete, if the lifting uses the Lazard evaluation to handle nullified polynomials @cite McCallumParusinskiPaunescu19 .
+		 */
+		template<typename Inserter>
+		void Lazard(const Poly& p, const Poly& q, Variable::Arg variable, Inserter& i) const {
+			CARL_LOG_DEBUG("carl.cad.projection", "resultant(" << p << ", " << q << ")");
+			i.insert(Cache::getInstance().resultant(*p, *q).switchVariable(variable), {p, q}, false);
+		}
+		template<typename Inserter>
+		void Lazard(const Poly& p, Variable::Arg variable, Inserter& i) const {
+			// Insert discriminant
+			CARL_LOG_DEBUG("carl.cad.projection", "discriminant(" << p << ")");
+			i.insert(Cache::getInstance().discriminant(*p).switchVariable(variable), {p}, false);
+			if (!p->lcoeff().isConstant()) {
+				CARL_LOG_DEBUG("carl.cad.projection", "\t-> lcoeff " << p->lcoeff());
+				i.insert(p->lcoeff().toUnivariatePolynomial(variable), {p}, false);
+			}
+			auto tcoeff = std::find_if(p->coefficients().begin(), p->coefficients().end(), [](const auto& c){ return !c.isZero(); });
+			if (tcoeff != p->coefficients().end() - 1 && !tcoeff->isConstant()) {
+				CARL_LOG_DEBUG("carl.cad.projection", "\t-> tcoeff " << *tcoeff);
+				i.insert(tcoeff->toUnivariatePolynomial(variable), {p}, false);
+			}
+		}
     };
 
+
+	/**
+	 * Stores the polynomials produced by a projection operator, such that projections can be computed independently of the elimination set they are inserted into.
+	 */
+	template<typename UPoly>
+	struct ProjectionResult {
+		std::vector<std::pair<UPoly, std::list<const UPoly*>>> polynomials;
+
+		void insert(const UPoly& p, const std::list<const UPoly*>& parents, bool avoidSingle) {
+			assert(!avoidSingle);
+			polynomials.emplace_back(p, parents);
+		}
+	};
+
+	/**
+	 * Computes a list of independent projections, using the given number of threads.
+	 * A task is either a pair of polynomials or a single polynomial, in which case the second entry is nullptr.
+	 * Idle threads fetch the next task from a shared counter, hence a single expensive resultant does not block the remaining tasks.
+	 *
+	 * Before a task is fetched, interrupted() is queried and no further tasks are started if it returns true.
+	 * As tasks are fetched in order, the finished tasks always form a prefix of the given list.
+	 * @param pt Projection operator.
+	 * @param tasks Projections to compute.
+	 * @param variable Main variable of the resulting polynomials.
+	 * @param results Resulting polynomials, one entry per task.
+	 * @param threads Number of threads.
+	 * @param interrupted Indicates whether the computation should be stopped.
+	 * @return Number of finished tasks.
+	 */
+	template<typename UPoly>
+	std::size_t projectParallel(
+		ProjectionType pt,
+		const std::vector<std::pair<const UPoly*, const UPoly*>>& tasks,
+		Variable::Arg variable,
+		std::vector<ProjectionResult<UPoly>>& results,
+		std::size_t threads,
+		const std::function<bool()>& interrupted
+	) {
+#ifndef THREAD_SAFE
+		if (threads > 1) {
+			CARL_LOG_WARN("carl.cad.projection", "Parallel projection requires THREAD_SAFE, falling back to a single thread.");
+			threads = 1;
+		}
+#endif
+		// Terms are ordered lazily, hence we order all polynomials before they are shared among the threads.
+		for (const auto& task: tasks) {
+			for (const auto& c: task.first->coefficients()) c.makeOrdered();
+			if (task.second == nullptr) continue;
+			for (const auto& c: task.second->coefficients()) c.makeOrdered();
+		}
+		results.clear();
+		results.resize(tasks.size());
+		std::atomic<std::size_t> next(0);
+		auto worker = [&]() {
+			ProjectionOperator<const UPoly*> projection;
+			while (!(interrupted && interrupted())) {
+				std::size_t id = next++;
+				if (id >= tasks.size()) return;
+				if (tasks[id].second == nullptr) {
+					projection(pt, tasks[id].first, variable, results[id]);
+				} else {
+					projection(pt, tasks[id].first, tasks[id].second, variable, results[id]);
+				}
+			}
+		};
+		threads = std::max(std::size_t(1), std::min(threads, tasks.size()));
+		CARL_LOG_DEBUG("carl.cad.projection", "Computing " << tasks.size() << " projections using " << threads << " threads");
+		std::vector<std::thread> pool;
+		for (std::size_t i = 1; i < threads; i++) pool.emplace_back(worker);
+		worker();
+		for (auto& t: pool) t.join();
+		return std::min(next.load(), tasks.size());
+	}
+
 }
 }
@@ -0,0 +1,109 @@
+/**
+ * @file ProjectionCache.h
+ * @ingroup cad
+ *
+ * Memoizes the expensive operations of the projection operators.
+ * The same resultants and discriminants are computed repeatedly when polynomials are removed and added again
+ * and when several CAD objects share polynomials, hence they are stored in a global cache.
+ */
+
+#pragma once
+
+#include "../core/polynomialfunctions/Resultant.h"
+#include "../util/hash.h"
+#include "../util/MemoCache.h"
+#include "../util/Singleton.h"
+
+#include <utility>
+
+namespace carl {
+namespace cad {
+
+/**
+ * Global cache for resultants and discriminants.
+ * The weight of an entry is the number of terms of the involved polynomials, the budget hence bounds the total number of stored terms.
+ * Polynomials are stored as they are given, in particular resultant(p, q) and resultant(q, p) are cached independently.
+ */
+template<typename UPoly>
+class ProjectionCache: public Singleton<ProjectionCache<UPoly>> {
+	friend Singleton<ProjectionCache<UPoly>>;
+public:
+	/// Default budget, counted in terms.
+	static constexpr std::size_t DefaultBudget = 1000000;
+private:
+	using Pair = std::pair<UPoly, UPoly>;
+	struct PairHash {
+		std::size_t operator()(const Pair& p) const {
+			return carl::hash_all(p.first, p.second);
+		}
+	};
+
+	MemoCache<Pair, UPoly, PairHash> mResultants;
+	MemoCache<UPoly, UPoly> mDiscriminants;
+
+	ProjectionCache(): mResultants(DefaultBudget), mDiscriminants(DefaultBudget) {}
+
+	static std::size_t weight(const UPoly& p) {
+		std::size_t res = 0;
+		for (const auto& c: p.coefficients()) res += c.nrTerms();
+		return res;
+	}
+	static std::size_t weight(const Pair& p) {
+		return weight(p.first) + weight(p.second);
+	}
+	/// Terms are ordered lazily, hence polynomials are ordered before they are hashed or shared with other threads.
+	static void makeOrdered(const UPoly& p) {
+		for (const auto& c: p.coefficients()) c.makeOrdered();
+	}
+	template<typename K, typename V>
+	static std::size_t entryWeight(const K& key, const V& value) {
+		return weight(key) + weight(value);
+	}
+public:
+	/// Returns the resultant of p and q.
+	UPoly resultant(const UPoly& p, const UPoly& q) {
+		makeOrdered(p);
+		makeOrdered(q);
+		return mResultants.get(Pair(p, q), [&](){
+			UPoly res = carl::resultant(p, q);
+			makeOrdered(res);
+			return res;
+		}, entryWeight<Pair, UPoly>);
+	}
+	/// Returns the discriminant of p.
+	UPoly discriminant(const UPoly& p) {
+		makeOrdered(p);
+		return mDiscriminants.get(p, [&](){
+			UPoly res = carl::discriminant(p);
+			makeOrdered(res);
+			return res;
+		}, entryWeight<UPoly, UPoly>);
+	}
+	/// Sets the budget of every single cache.
+	void setBudget(std::size_t budget) {
+		mResultants.setBudget(budget);
+		mDiscriminants.setBudget(budget);
+	}
+	/// Removes all entries and resets the statistics.
+	void clear() {
+		mResultants.clear();
+		mDiscriminants.clear();
+	}
+	MemoCacheStatistics resultantStatistics() const {
+		return mResultants.statistics();
+	}
+	MemoCacheStatistics discriminantStatistics() const {
+		return mDiscriminants.statistics();
+	}
+};
+
+template<typename UPoly>
+std::ostream& operator<<(std::ostream& os, const ProjectionCache<UPoly>& pc) {
+	os << "Projection cache:" << std::endl;
+	os << "\tresultants: " << pc.resultantStatistics() << std::endl;
+	os << "\tdiscriminants: " << pc.discriminantStatistics() << std::endl;
+	return os;
+}
+
+}
+}
@@ -0,0 +1,212 @@
+/**
+ * @file HeapArithmetic.h
+ * @ingroup multirp
+ *
+ * Heap-based multiplication and division of sparse polynomials as described in @cite MonaganPearce2007.
+ * Instead of collecting all intermediate terms in a TermAdditionManager, the terms of the result are produced
+ * in descending order from a heap whose size is bounded by the number of terms of one operand.
+ */
+
+#pragma once
+
+#include "CompareResult.h"
+#include "Monomial.h"
+#include "Term.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+	/**
+	 * Entry of the heap: the product of the terms at the given positions of two term sequences.
+	 */
+	struct HeapArithmeticEntry {
+		/// Monomial of the product.
+		Monomial::Arg monomial;
+		/// Position within the first sequence.
+		std::size_t first;
+		/// Position within the second sequence.
+		std::size_t second;
+	};
+
+	/**
+	 * Heap of HeapArithmeticEntry objects, the largest monomial (with respect to Ordering) being on top.
+	 * Besides the usual operations, the top entry can be replaced, which needs a single sift-down instead of a pop and a push.
+	 */
+	template<typename Ordering>
+	class HeapArithmeticQueue {
+	private:
+		std::vector<HeapArithmeticEntry> mHeap;
+		static bool less(const HeapArithmeticEntry& lhs, const HeapArithmeticEntry& rhs) {
+			return Ordering::less(lhs.monomial, rhs.monomial);
+		}
+		/**
+		 * Inserts the given entry at the root.
+		 * As new entries usually belong to the bottom of the heap, the hole is moved down to a leaf first
+		 * (comparing only the children) and the entry is then moved up from there.
+		 */
+		void siftDown(HeapArithmeticEntry&& entry) {
+			std::size_t hole = 0;
+			std::size_t child = 1;
+			while (child < mHeap.size()) {
+				if (child + 1 < mHeap.size() && less(mHeap[child], mHeap[child + 1])) child++;
+				mHeap[hole] = std::move(mHeap[child]);
+				hole = child;
+				child = 2 * hole + 1;
+			}
+			while (hole > 0) {
+				std::size_t parent = (hole - 1) / 2;
+				if (!less(mHeap[parent], entry)) break;
+				mHeap[hole] = std::move(mHeap[parent]);
+				hole = parent;
+			}
+			mHeap[hole] = std::move(entry);
+		}
+	public:
+		explicit HeapArithmeticQueue(std::size_t capacity) {
+			mHeap.reserve(capacity);
+		}
+		bool empty() const {
+			return mHeap.empty();
+		}
+		const HeapArithmeticEntry& top() const {
+			assert(!empty());
+			return mHeap.front();
+		}
+		void push(Monomial::Arg&& monomial, std::size_t first, std::size_t second) {
+			mHeap.push_back(HeapArithmeticEntry({std::move(monomial), first, second}));
+			std::push_heap(mHeap.begin(), mHeap.end(), &HeapArithmeticQueue::less);
+		}
+		void pop() {
+			assert(!empty());
+			HeapArithmeticEntry last = std::move(mHeap.back());
+			mHeap.pop_back();
+			if (!empty()) siftDown(std::move(last));
+		}
+		/**
+		 * Replaces the top entry by an entry that is not larger.
+		 */
+		void replaceTop(Monomial::Arg&& monomial, std::size_t first, std::size_t second) {
+			assert(!empty());
+			assert(!Ordering::less(mHeap.front().monomial, monomial));
+			siftDown(HeapArithmeticEntry({std::move(monomial), first, second}));
+		}
+	};
+
+	/**
+	 * Multiplies two polynomials given as sequences of terms.
+	 * Both sequences must be fully ordered with respect to Ordering, i.e. the leading term is the last one.
+	 * @param lhs First factor.
+	 * @param rhs Second factor.
+	 * @param result Fully ordered terms of lhs * rhs.
+	 */
+	template<typename Ordering, typename Terms>
+	void heapMultiply(const Terms& lhs, const Terms& rhs, Terms& result) {
+		using Coeff = typename std::decay<decltype(std::declval<typename Terms::value_type>().coeff())>::type;
+		result.clear();
+		if (lhs.empty() || rhs.empty()) return;
+		// The heap never holds more entries than the shorter factor has terms.
+		const Terms& f = (lhs.size() <= rhs.size()) ? lhs : rhs;
+		const Terms& g = (lhs.size() <= rhs.size()) ? rhs : lhs;
+		// Access terms in descending order.
+		auto F = [&f](std::size_t i) -> const Term<Coeff>& { return f[f.size() - 1 - i]; };
+		auto G = [&g](std::size_t i) -> const Term<Coeff>& { return g[g.size() - 1 - i]; };
+
+		// The product may have far fewer than f.size() * g.size() terms, hence the result grows with its actual size.
+		result.reserve(f.size() + g.size());
+		HeapArithmeticQueue<Ordering> heap(f.size());
+		heap.push(F(0).monomial() * G(0).monomial(), 0, 0);
+		while (!heap.empty()) {
+			Monomial::Arg monomial = heap.top().monomial;
+			Coeff coeff = constant_zero<Coeff>::get();
+			// Monomials are unique within the MonomialPool, hence equality is checked by comparing pointers.
+			do {
+				std::size_t i = heap.top().first;
+				std::size_t j = heap.top().second;
+				coeff += F(i).coeff() * G(j).coeff();
+				// The successors of an entry are smaller than the entry itself.
+				if (j + 1 < g.size()) {
+					heap.replaceTop(F(i).monomial() * G(j + 1).monomial(), i, j + 1);
+				} else {
+					heap.pop();
+				}
+				if (j == 0 && i + 1 < f.size()) {
+					heap.push(F(i + 1).monomial() * G(0).monomial(), i + 1, 0);
+				}
+			} while (!heap.empty() && heap.top().monomial == monomial);
+			if (!carl::isZero(coeff)) {
+				result.emplace_back(std::move(coeff), std::move(monomial));
+			}
+		}
+		std::reverse(result.begin(), result.end());
+	}
+
+	/**
+	 * Divides a polynomial by another polynomial, both given as sequences of terms.
+	 * Terms that are not divisible by the leading term of the divisor are moved to the remainder.
+	 * If no remainder is requested, the division is exact and fails as soon as such a term occurs.
+	 * Both sequences must be fully ordered with respect to Ordering, i.e. the leading term is the last one.
+	 * @param dividend Dividend.
+	 * @param divisor Divisor, must not be empty.
+	 * @param quotient Fully ordered terms of the quotient.
+	 * @param remainder Fully ordered terms of the remainder or nullptr.
+	 * @return false, if no remainder was requested and the division is not exact.
+	 */
+	template<typename Ordering, typename Terms>
+	bool heapDivide(const Terms& dividend, const Terms& divisor, Terms& quotient, Terms* remainder) {
+		using Coeff = typename std::decay<decltype(std::declval<typename Terms::value_type>().coeff())>::type;
+		assert(!divisor.empty());
+		quotient.clear();
+		if (remainder != nullptr) remainder->clear();
+		const Term<Coeff>& lterm = divisor.back();
+		auto G = [&divisor](std::size_t i) -> const Term<Coeff>& { return divisor[divisor.size() - 1 - i]; };
+
+		// Entries represent the products quotient[first] * G(second) that still have to be subtracted.
+		HeapArithmeticQueue<Ordering> heap(dividend.size());
+		auto next = dividend.rbegin();
+		while (next != dividend.rend() || !heap.empty()) {
+			Monomial::Arg monomial;
+			if (heap.empty()) monomial = next->monomial();
+			else if (next == dividend.rend()) monomial = heap.top().monomial;
+			else if (Ordering::less(next->monomial(), heap.top().monomial)) monomial = heap.top().monomial;
+			else monomial = next->monomial();
+
+			Coeff coeff = constant_zero<Coeff>::get();
+			if (next != dividend.rend() && next->monomial() == monomial) {
+				coeff = next->coeff();
+				++next;
+			}
+			while (!heap.empty() && heap.top().monomial == monomial) {
+				std::size_t i = heap.top().first;
+				std::size_t j = heap.top().second;
+				coeff -= quotient[i].coeff() * G(j).coeff();
+				if (j + 1 < divisor.size()) {
+					heap.replaceTop(quotient[i].monomial() * G(j + 1).monomial(), i, j + 1);
+				} else {
+					heap.pop();
+				}
+			}
+			if (carl::isZero(coeff)) continue;
+
+			Term<Coeff> term(std::move(coeff), std::move(monomial));
+			Term<Coeff> factor;
+			if (term.divide(lterm, factor)) {
+				quotient.push_back(std::move(factor));
+				if (divisor.size() > 1) {
+					heap.push(quotient.back().monomial() * G(1).monomial(), quotient.size() - 1, 1);
+				}
+			} else if (remainder != nullptr) {
+				remainder->push_back(std::move(term));
+			} else {
+				quotient.clear();
+				return false;
+			}
+		}
+		std::reverse(quotient.begin(), quotient.end());
+		if (remainder != nullptr) std::reverse(remainder->begin(), remainder->end());
+		return true;
+	}
+}
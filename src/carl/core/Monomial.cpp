@@ -11,9 +11,13 @@
 namespace carl
 {
 	Monomial::~Monomial() {
-		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << *this);
-		MonomialPool::getInstance().free(this);
+		CARL_LOG_TRACE("carl.core.monomial", "Destructing " << *this);
 	}
+
+	void freeMonomial(const Monomial* m) {
+		MonomialPool::getInstance().free(m);
+	}
+
 	Monomial::Arg Monomial::dropVariable(Variable v) const
 	{
 		///@todo this should work on the shared_ptr directly. Then we could directly return this shared_ptr instead of the ugly copying.
@@ -78,6 +82,10 @@ namespace carl
 			CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " fails");
 			return false;
 		}
+		if (mPacked.valid() && m->mPacked.valid() && !PackedExponents::divisible(mPacked, m->mPacked)) {
+			CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " fails");
+			return false;
+		}
 		Content newExps;
 
 		// Linear, as we expect small monomials.
@@ -211,6 +219,11 @@ namespace carl
             CARL_LOG_FUNC("carl.core.monomial", lhs << ", " << rhs);
             assert(lhs->isConsistent());
             assert(rhs->isConsistent());
+            if (lhs->mPacked.valid() && rhs->mPacked.valid()) {
+                if (PackedExponents::coprime(lhs->mPacked, rhs->mPacked)) return nullptr;
+                if (PackedExponents::divisible(lhs->mPacked, rhs->mPacked)) return rhs;
+                if (PackedExponents::divisible(rhs->mPacked, lhs->mPacked)) return lhs;
+            }
 
             Content newExps;
             uint expsum = 0;
@@ -240,7 +253,7 @@ namespace carl
                 }
             }
              // Insert remaining part
-            std::shared_ptr<const Monomial> result;
+            Monomial::Arg result;
             if (!newExps.empty()) {
 				result = createMonomial(std::move(newExps), expsum);
             }
@@ -248,7 +261,7 @@ namespace carl
             return result;
 	}
 	
-	Monomial::Arg Monomial::lcm(const std::shared_ptr<const Monomial>& lhs, const std::shared_ptr<const Monomial>& rhs)
+	Monomial::Arg Monomial::lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		if (!lhs && !rhs) return nullptr;
 		if (!lhs) return rhs;
@@ -256,6 +269,10 @@ namespace carl
 		CARL_LOG_FUNC("carl.core.monomial", lhs << ", " << rhs);
 		assert(lhs->isConsistent());
 		assert(rhs->isConsistent());
+		if (lhs->mPacked.valid() && rhs->mPacked.valid()) {
+			if (PackedExponents::divisible(lhs->mPacked, rhs->mPacked)) return lhs;
+			if (PackedExponents::divisible(rhs->mPacked, lhs->mPacked)) return rhs;
+		}
 
 		Content newExps;
 		uint expsum = lhs->tdeg() + rhs->tdeg();
@@ -270,7 +287,7 @@ namespace carl
 			{
 				// Insert remaining part
 				newExps.insert(newExps.end(), itleft, lhs->mExponents.end());
-				std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+				Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 				CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 				return result;
 			}
@@ -299,7 +316,7 @@ namespace carl
 		}
 		 // Insert remaining part
 		newExps.insert(newExps.end(), itright, rhs->mExponents.end());
-		std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+		Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 		CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 		return result;
 	}
@@ -338,6 +355,9 @@ namespace carl
 		assert( (&lhs != &rhs) || (lhs.id() == rhs.id()) );
 		assert((lhs.id() != 0) && (rhs.id() != 0));
 		if (lhs.id() == rhs.id()) return CompareResult::EQUAL;
+		if (lhs.mPacked.valid() && rhs.mPacked.valid()) {
+			return PackedExponents::lexicalCompare(lhs.mPacked, rhs.mPacked);
+		}
 		auto lhsit = lhs.mExponents.begin();
 		auto rhsit = rhs.mExponents.begin();
 		auto lhsend = lhs.mExponents.end();
@@ -7,13 +7,18 @@
 
 #pragma once
 
+#include "../config.h"
 #include "../numbers/numbers.h"
 #include "CompareResult.h"
+#include "PackedExponents.h"
 #include "Variable.h"
 #include "VariablePool.h"
 #include "logging.h"
 
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <set>
 #include <sstream>
@@ -53,11 +58,24 @@ namespace carl
 	class Monomial final
 	{
 		friend class MonomialPool;
+		friend void intrusive_ptr_add_ref(const Monomial* m);
+		friend void intrusive_ptr_release(const Monomial* m);
 	public:
-		using Arg = std::shared_ptr<const Monomial>;
+		/**
+		 * Handle to a monomial from the MonomialPool.
+		 * The reference count is stored within the monomial itself and is only atomic if THREAD_SAFE is set.
+		 */
+		using Arg = boost::intrusive_ptr<const Monomial>;
 		using Content = std::vector<std::pair<Variable, uint>>;
 		~Monomial();
 	private:
+#ifdef THREAD_SAFE
+		using RefCount = std::atomic<std::size_t>;
+#else
+		using RefCount = std::size_t;
+#endif
+		/// Number of handles referring to this monomial.
+		mutable RefCount mRefCount{0};
 		/// A vector of variable exponent pairs (v_i^e_i) with nonzero exponents.
 		Content mExponents;
 		/// Some applications performance depends on getting the degree of monomials very fast
@@ -66,6 +84,8 @@ namespace carl
 		mutable std::size_t mId = 0;
 		/// Cached hash.
 		mutable std::size_t mHash = 0;
+		/// Packed exponent vector, set by the MonomialPool if possible.
+		mutable PackedExponents mPacked;
 
 		using exponents_it = Content::iterator ;
 		using exponents_cIt = Content::const_iterator;
@@ -212,6 +232,15 @@ namespace carl
 			return mExponents;
 		}
 		
+		/**
+		 * Returns the packed exponent vector.
+		 * It is invalid if the monomial could not be packed or if the MonomialPool does not pack monomials.
+		 * @return Packed exponents.
+		 */
+		const PackedExponents& packed() const {
+			return mPacked;
+		}
+		
 		/**
 		 * Checks whether the monomial is a constant.
 		 * @return If monomial is constant.
@@ -355,6 +384,9 @@ namespace carl
 			assert(isConsistent());
 			if(m->mTotalDegree > mTotalDegree) return false;
 			if(m->nrVariables() > nrVariables()) return false;
+			if(mPacked.valid() && m->mPacked.valid()) {
+				return PackedExponents::divisible(mPacked, m->mPacked);
+			}
 			// Linear, as we expect small monomials.
 			auto itright = m->mExponents.begin();
 			for (const auto& itleft: mExponents) {
@@ -718,7 +750,7 @@ namespace carl
 		return os;
 	}
 	/**
-	 * Streaming operator for std::shared_ptr<Monomial>.
+	 * Streaming operator for Monomial::Arg.
 	 * @param os Output stream.
 	 * @param rhs Monomial.
 	 * @return `os`
@@ -728,6 +760,40 @@ namespace carl
 		return os << "1";
 	}
 	
+	/**
+	 * Releases a monomial whose last handle is about to be dropped.
+	 * Removes the monomial from the MonomialPool and deletes it unless it was revived in the meantime.
+	 * @param m Monomial.
+	 */
+	void freeMonomial(const Monomial* m);
+
+	/**
+	 * Increments the reference count of a monomial, used by Monomial::Arg.
+	 * @param m Monomial.
+	 */
+	inline void intrusive_ptr_add_ref(const Monomial* m) {
+		++m->mRefCount;
+	}
+	/**
+	 * Decrements the reference count of a monomial, used by Monomial::Arg.
+	 * The last reference is dropped by the MonomialPool, such that concurrent lookups can not revive a deleted monomial.
+	 * @param m Monomial.
+	 */
+	inline void intrusive_ptr_release(const Monomial* m) {
+#ifdef THREAD_SAFE
+		std::size_t count = m->mRefCount.load(std::memory_order_relaxed);
+		while (count > 1) {
+			if (m->mRefCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel)) return;
+		}
+#else
+		if (m->mRefCount > 1) {
+			--m->mRefCount;
+			return;
+		}
+#endif
+		freeMonomial(m);
+	}
+
 	Monomial::Arg pow(Variable v, std::size_t exp);
 	inline Monomial::Arg pow(const Monomial::Arg& m, std::size_t exp) {
 		return m->pow(exp);
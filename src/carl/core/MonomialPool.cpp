@@ -9,66 +9,38 @@
 
 namespace carl
 {
-	Monomial::Arg MonomialPool::add( MonomialPool::PoolEntry&& pe, exponent totalDegree) {
-		CARL_LOG_TRACE("carl.core.monomial", pe.content << " / " << pe.hash << ", " << totalDegree);
-		for (const auto& pe: mPool) {
-			CARL_LOG_TRACE("carl.core.monomial", "\t" << pe.content << " / " << pe.hash << " / " << pe.monomial.lock().get());
-		}
-		MONOMIAL_POOL_LOCK_GUARD
-		auto iter = mPool.insert(std::move(pe));
-		Monomial::Arg res;
-		if (iter.second) {
-			CARL_LOG_TRACE("carl.core.monomial", "Was newly added");
-			if (iter.first->monomial.expired()) {
-				CARL_LOG_TRACE("carl.core.monomial", "Weakptr is expired");
-				if (totalDegree == 0) {
-					res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
-					iter.first->monomial = res;
-				} else {
-					res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content, totalDegree));
-					iter.first->monomial = res;
-				}
-			} else {
-				res = iter.first->monomial.lock();
-				CARL_LOG_TRACE("carl.core.monomial", "Got existing weakptr as " << res);
-			}
-			res->mId = mIDs.get();
-			CARL_LOG_TRACE("carl.core.monomial", "ID = " << res->mId);
-		} else {
-			res = iter.first->monomial.lock();
-			CARL_LOG_TRACE("carl.core.monomial", "Was already there as " << res);
-		}
-		return res;
-	}
-
-	Monomial::Arg MonomialPool::add( const Monomial::Arg& _monomial ) {
-		assert(_monomial->id() == 0);
-		PoolEntry pe(_monomial->hash(), _monomial->exponents(), _monomial);
-		MONOMIAL_POOL_LOCK_GUARD
-		auto iter = mPool.insert(pe);
-		if (iter.second) {
-			_monomial->mId = mIDs.get();
-			return _monomial;
-		} else {
-			assert(_monomial == iter.first->monomial.lock());
-			return iter.first->monomial.lock();
-		}
-	}
-	
 	Monomial::Arg MonomialPool::add( Monomial::Content&& c, exponent totalDegree) {
 		CARL_LOG_TRACE("carl.core.monomial", c << ", " << totalDegree);
-		return MonomialPool::add(PoolEntry(std::move(c)), totalDegree);
+		std::size_t hash = Monomial::hashContent(c);
+		// Only used for the lookup, never referenced by a handle.
+		Monomial probe = (totalDegree == 0) ? Monomial(hash, std::move(c)) : Monomial(hash, std::move(c), totalDegree);
+		std::size_t index = shardIndex(hash);
+		Shard& shard = mShards[index];
+		MONOMIAL_POOL_LOCK_GUARD(shard)
+		auto iter = shard.pool.find(&probe);
+		if (iter != shard.pool.end()) {
+			CARL_LOG_TRACE("carl.core.monomial", "Was already there as " << *iter);
+			return Monomial::Arg(*iter);
+		}
+		auto* res = new Monomial(hash, std::move(probe.mExponents), probe.mTotalDegree);
+		res->mId = allocateID(index);
+		if (mPackExponents) {
+			res->mPacked = PackedExponents::pack(res->mExponents);
+		}
+		shard.pool.insert(res);
+		CARL_LOG_TRACE("carl.core.monomial", "Was newly added as " << res << " with ID = " << res->mId);
+		return Monomial::Arg(res);
 	}
 	
 	Monomial::Arg MonomialPool::create()
 	{
-		return add(Monomial::Arg());
+		return Monomial::Arg();
 	}
 
 	Monomial::Arg MonomialPool::create( Variable _var, exponent _exp )
 	{
 		CARL_LOG_TRACE("carl.core.monomial", _var << ", " << _exp);
-		return add(Monomial::Arg(new Monomial(_var, _exp)));
+		return add(Monomial::Content(1, std::make_pair(_var, _exp)), _exp);
 	}
 
 	Monomial::Arg MonomialPool::create( std::vector<std::pair<Variable, exponent>>&& _exponents, exponent _totalDegree )
@@ -79,8 +51,9 @@ namespace carl
 
 	Monomial::Arg MonomialPool::create( const std::initializer_list<std::pair<Variable, exponent>>& _exponents )
 	{
-		//CARL_LOG_TRACE("carl.core.monomial", _exponents);
-		return add(Monomial::Arg(new Monomial(_exponents)));
+		Monomial::Content exps(_exponents);
+		std::sort(exps.begin(), exps.end(), [](const std::pair<Variable, exponent>& p1, const std::pair<Variable, exponent>& p2){ return p1.first < p2.first; });
+		return add(std::move(exps));
 	}
 
 	Monomial::Arg MonomialPool::create( std::vector<std::pair<Variable, exponent>>&& _exponents )
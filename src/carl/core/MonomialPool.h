@@ -12,9 +12,15 @@
 #include "Monomial.h"
 #include "config.h"
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <unordered_set>
 
+#ifdef THREAD_SAFE
+#include <mutex>
+#endif
+
 namespace carl{
 
 
@@ -23,58 +29,81 @@ namespace carl{
 		friend class Singleton<MonomialPool>;
 		friend std::ostream& operator<<(std::ostream& os, const MonomialPool& mp);
 		public:
-			struct PoolEntry {
-				Monomial::Content content;
-				std::size_t hash;
-				mutable std::weak_ptr<const Monomial> monomial;
-				PoolEntry(std::size_t h, Monomial::Content c, const Monomial::Arg& m): content(std::move(c)), hash(h), monomial(m) {}
-				PoolEntry(std::size_t h, Monomial::Content c): content(std::move(c)), hash(h) {
-					assert(monomial.expired());
-				}
-				explicit PoolEntry(Monomial::Content c): content(std::move(c)), hash(Monomial::hashContent(content)), monomial() {
-					assert(monomial.expired());
-				}
-			};
 			struct hash {
-				std::size_t operator()(const PoolEntry& p) const {
-					return p.hash;
+				std::size_t operator()(const Monomial* m) const {
+					return m->hash();
 				}
 			};
 			struct equal {
-				bool operator()(const PoolEntry& p1, const PoolEntry& p2) const {
-					CARL_LOG_TRACE("carl.core.monomial", p1.content << " / " << p1.hash << " / " << p1.monomial.lock().get() << " == " << p2.content << " / " << p2.hash << " / " << p2.monomial.lock().get());
-					if (p1.hash != p2.hash) {
-						CARL_LOG_TRACE("carl.core.monomial", "No due to hash");
-						return false;
-					}
-					if (p1.monomial.lock() && p2.monomial.lock()) {
-						CARL_LOG_TRACE("carl.core.monomial", "Comparing pointers");
-						return p1.monomial.lock() == p2.monomial.lock();
-					}
-					CARL_LOG_TRACE("carl.core.monomial", "Comparing content");
-					return p1.content == p2.content;
+				bool operator()(const Monomial* m1, const Monomial* m2) const {
+					if (m1 == m2) return true;
+					if (m1->hash() != m2->hash()) return false;
+					return m1->exponents() == m2->exponents();
 				}
 			};
 		private:
+			/// Number of shards, must be a power of two.
+			static constexpr std::size_t NumShards = 16;
+			/**
+			 * A shard holds all monomials whose hash maps to this shard.
+			 * As every content is stored in exactly one shard, the uniqueness of monomials is retained.
+			 * Every shard has its own id allocator and (if THREAD_SAFE is set) its own mutex, hence threads only contend if they access the same shard.
+			 */
+			struct Shard {
+				/// id allocator of this shard
+				IDPool ids;
+				/// The pool, owning all monomials that are referenced by some Monomial::Arg.
+				std::unordered_set<Monomial*, MonomialPool::hash, MonomialPool::equal> pool;
+				#ifdef THREAD_SAFE
+				/// Mutex to avoid multiple access to this shard
+				mutable std::mutex mutex;
+				#endif
+			};
 			// Members:
-			/// id allocator
-			IDPool mIDs;
-			//size_t mIdAllocator;
-			/// The pool.
-			std::unordered_set<PoolEntry, MonomialPool::hash, MonomialPool::equal> mPool;
-			/// Mutex to avoid multiple access to the pool
-			mutable std::recursive_mutex mMutex;
+			/// The shards.
+			std::array<Shard, NumShards> mShards;
+			/// Largest id that has been handed out so far.
+			std::atomic<std::size_t> mLargestID;
+			/// Whether new monomials get a packed exponent vector.
+			std::atomic<bool> mPackExponents;
 			
             #ifdef THREAD_SAFE
-			#define MONOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutex );
-			#define MONOMIAL_POOL_LOCK mMutex.lock();
-			#define MONOMIAL_POOL_UNLOCK mMutex.unlock();
+			#define MONOMIAL_POOL_LOCK_GUARD(shard) std::lock_guard<std::mutex> lock( (shard).mutex );
             #else
-			#define MONOMIAL_POOL_LOCK_GUARD
-			#define MONOMIAL_POOL_LOCK
-			#define MONOMIAL_POOL_UNLOCK
+			#define MONOMIAL_POOL_LOCK_GUARD(shard)
             #endif
 
+			/**
+			 * Selects the shard responsible for the given hash.
+			 * @param hash Hash of a monomial.
+			 * @return Index of the shard.
+			 */
+			static std::size_t shardIndex(std::size_t hash) {
+				return (hash ^ (hash >> 16)) & (NumShards - 1);
+			}
+			/**
+			 * Allocates a new id from the given shard.
+			 * The ids of all shards are interleaved such that id 0 is never used and the ids stay reasonably dense.
+			 * Assumes that the shard is locked.
+			 * @param index Index of the shard.
+			 * @return Globally unique id.
+			 */
+			std::size_t allocateID(std::size_t index) {
+				std::size_t id = mShards[index].ids.get() * NumShards + index + 1;
+				std::size_t largest = mLargestID.load(std::memory_order_relaxed);
+				while (id > largest && !mLargestID.compare_exchange_weak(largest, id, std::memory_order_relaxed)) {}
+				return id;
+			}
+			/**
+			 * Returns an id to the shard it was allocated from.
+			 * Assumes that the shard is locked.
+			 * @param index Index of the shard.
+			 * @param id Id to be freed.
+			 */
+			void freeID(std::size_t index, std::size_t id) {
+				assert((id - 1) % NumShards == index);
+				mShards[index].ids.free((id - 1) / NumShards);
+			}
 			
 		protected:
 			
@@ -83,10 +112,12 @@ namespace carl{
 			 * @param _capacity Expected necessary capacity of the pool.
 			 */
 			explicit MonomialPool( std::size_t _capacity = 10000 ):
-				mPool(_capacity)
+				mLargestID(0),
+				mPackExponents(true)
 			{
-				mIDs.get();
-				assert(mIDs.largestID() == 0);
+				for (auto& shard: mShards) {
+					shard.pool.reserve(_capacity / NumShards);
+				}
 				VariablePool::getInstance();
 				CARL_LOG_DEBUG("carl.pool", "Monomialpool constructed");
 			}
@@ -95,15 +126,14 @@ namespace carl{
 				CARL_LOG_DEBUG("carl.pool", "Monomialpool destructed");
 			}
 
-			Monomial::Arg add( MonomialPool::PoolEntry&& pe, exponent totalDegree = 0 );
 		public:
 			
 			/**
 			 * Try to add the given monomial to the pool.
-			 * @param _monomial The monomial to add.
+			 * @param c The content of the monomial.
+			 * @param totalDegree The total degree of the monomial or zero, if it shall be computed.
 			 * @return The corresponding monomial in the pool.
 			 */
-			Monomial::Arg add( const Monomial::Arg& _monomial );
 			Monomial::Arg add( Monomial::Content&& c, exponent totalDegree = 0 );
 			
 			Monomial::Arg create();
@@ -119,42 +149,85 @@ namespace carl{
 			
 			Monomial::Arg create( std::vector<std::pair<Variable, exponent>>&& _exponents );
 
+			/**
+			 * Drops the last reference to the given monomial.
+			 * The reference count is decremented while the respective shard is locked.
+			 * If no other thread obtained the monomial from the pool in the meantime, it is removed from the pool and deleted.
+			 * @param m Monomial.
+			 */
 			void free(const Monomial* m) {
 				CARL_LOG_TRACE("carl.core.monomial", "Freeing " << m);
 				if (m == nullptr) return;
-				if (m->id() == 0) return;
-				MONOMIAL_POOL_LOCK_GUARD;
-				PoolEntry pe(m->mHash, m->mExponents);
-				auto it = mPool.find(pe);
-				if (it != mPool.end()) {
-					CARL_LOG_TRACE("carl.core.monomial", "Found " << it->content << " / " << it->hash);
-					mIDs.free(m->id());
-					mPool.erase(it);
-				} else {
-					CARL_LOG_TRACE("carl.core.monomial", "Not found in pool.");
+				std::size_t index = shardIndex(m->mHash);
+				Shard& shard = mShards[index];
+				{
+					MONOMIAL_POOL_LOCK_GUARD(shard)
+					// The id is reset by clear() while holding the lock of this shard.
+					if (m->id() == 0) {
+						// Monomial is not part of the pool (anymore).
+						if (--m->mRefCount > 0) return;
+					} else {
+						if (--m->mRefCount > 0) {
+							CARL_LOG_TRACE("carl.core.monomial", "Monomial was revived, keeping it.");
+							return;
+						}
+						auto it = shard.pool.find(const_cast<Monomial*>(m));
+						assert(it != shard.pool.end() && *it == m);
+						shard.pool.erase(it);
+						freeID(index, m->id());
+					}
 				}
+				delete m;
 			}
 
 			/**
 			 * Clears everything already created in this pool.
 			 */
 			void clear() {
-				mPool.clear();
-				mIDs.clear();
+				for (auto& shard: mShards) {
+					MONOMIAL_POOL_LOCK_GUARD(shard)
+					// Remaining monomials are deleted once their last handle is dropped.
+					for (auto& m: shard.pool) {
+						m->mId = 0;
+					}
+					shard.pool.clear();
+					shard.ids.clear();
+				}
+				mLargestID = 0;
 			}
 
 			std::size_t size() const {
-				return mPool.size();
+				std::size_t res = 0;
+				for (const auto& shard: mShards) {
+					MONOMIAL_POOL_LOCK_GUARD(shard)
+					res += shard.pool.size();
+				}
+				return res;
 			}
 			std::size_t largestID() const {
-				return mIDs.largestID();
+				return mLargestID.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * Sets whether newly created monomials store a PackedExponents representation.
+			 * Packed exponents speed up comparisons and divisibility checks if only few variables are used.
+			 * Monomials that already exist are not affected.
+			 * @param pack Whether to pack exponents.
+			 */
+			void setPackExponents(bool pack) {
+				mPackExponents = pack;
+			}
+			bool packExponents() const {
+				return mPackExponents;
 			}
 	};
 	
 	inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
 		os << "MonomialPool of size " << mp.size() << std::endl;
-		for (const auto& entry: mp.mPool) {
-			os << "\t" << entry.content << " / " << entry.hash << std::endl;
+		for (const auto& shard: mp.mShards) {
+			for (const auto& m: shard.pool) {
+				os << "\t" << *m << " / " << m->hash() << std::endl;
+			}
 		}
 		return os;
 	}
@@ -14,6 +14,8 @@
 #include "MultivariatePolynomial.h"
 #include "VariablesInformation.h"
 
+#include "polynomialfunctions/ModularGCD.h"
+
 #include "../numbers/FunctionSelector.h"
 #include "../converter/CoCoAAdaptor.h"
 
@@ -59,11 +61,11 @@ using types = carl::function_selector::wrap_types<mpz_class,mpq_class>;
 auto s = carl::createFunctionSelector<TypeSelector, types>(
 #if defined USE_COCOA
 	[](const auto& n1, const auto& n2){ CoCoAAdaptor<Polynomial> c({n1, n2}); return c.gcd(n1,n2); },
-	[](const auto& n1, const auto& n2){ CoCoAAdaptor<Polynomial> c({n1, n2}); return c.gcd(n1,n2); }
 #else
 	[this](const auto& n1, const auto& n2){ return this->customCalculation(n1,n2); },
-	[this](const auto& n1, const auto& n2){ return this->customCalculation(n1,n2); }
 #endif
+	// Rational polynomials use the native modular algorithm, avoiding the conversion to CoCoA.
+	[](const auto& n1, const auto& n2){ return modular_gcd::compute(n1, n2); }
 #if defined USE_GINAC
 	,
 	[](const auto& n1, const auto& n2){ return ginacGcd<Polynomial>( n1, n2 ); },
@@ -7,7 +7,9 @@
 
 #pragma once
 #include "../numbers/numbers.h"
+#include "MultivariatePolynomial.h"
 #include "UnivariatePolynomial.h"
+#include "polynomialfunctions/GCD.h"
 #include "logging.h"
 #include <list>
 
@@ -241,17 +243,96 @@ class DiophantineEquations
 	}
 };
 
+/**
+ * Lifts a factorization of the univariate image of a polynomial to a factorization of the polynomial.
+ * The leading coefficients of the factors are imposed as proposed by Wang @cite Wang78, the lifting is done
+ * with respect to the ideal generated by the evaluation point as in @cite GCL92, Algorithm 6.4.
+ * All computations are done over the rationals, hence no coefficient bound is necessary.
+ */
 template<typename Coeff, typename Ordering, typename Policies>
 class MultivariateHensel
 {
-	typedef Coeff Integer;
-	typedef UnivariatePolynomial<MultivariatePolynomial<Coeff,Ordering,Policies>> UnivReprPol;
-	
-	
-	static std::list<UnivReprPol> calculate(const UnivReprPol& , const std::map<Variable, Coeff>& , Integer )
+	typedef MultivariatePolynomial<Coeff,Ordering,Policies> Polynomial;
+	typedef UnivariatePolynomial<Coeff> UPolynomial;
+	typedef std::map<Variable, Coeff> Point;
+
+	/// Substitutes every variable v of the point by v + a (or v - a if inverse is set).
+	static Polynomial shift(Polynomial p, const Point& point, bool inverse)
 	{
-		
+		for (const auto& a: point) {
+			if (isZero(a.second)) continue;
+			p.substituteIn(a.first, Polynomial(a.first) + (inverse ? Coeff(-a.second) : a.second));
+		}
+		return p;
+	}
+
+	/// Replaces the leading coefficient of the image by lc, given as polynomial in the shifted variables.
+	static Polynomial imposeLeadingCoefficient(const UPolynomial& image, const Polynomial& lc)
+	{
+		Polynomial xn = Polynomial(image.mainVar()).pow(image.degree());
+		return Polynomial(image) - xn * image.lcoeff() + lc * xn;
+	}
+
+public:
+	/**
+	 * Computes g and h such that lc * f = g * h, where lc is the leading coefficient of f in x, such that
+	 * both g and h have leading coefficient lc and coincide with the given images at the point up to a constant factor.
+	 * @param f Polynomial that is primitive with respect to x.
+	 * @param x Main variable.
+	 * @param point Evaluation point for all other variables such that the leading coefficient does not vanish.
+	 * @param gImage Image of the first factor.
+	 * @param hImage Image of the second factor, coprime to gImage.
+	 * @param g First factor.
+	 * @param h Second factor.
+	 * @return If there is such a factorization.
+	 */
+	static bool lift(const Polynomial& f, Variable x, const Point& point, const UPolynomial& gImage, const UPolynomial& hImage, Polynomial& g, Polynomial& h)
+	{
+		Polynomial lc = shift(f.lcoeff(x), point, false);
+		Polynomial F = shift(f, point, false) * lc;
+		assert(lc.isConstant() || !isZero(lc.constantPart()));
+		Coeff lcAtPoint = lc.constantPart();
+		UPolynomial gi = gImage * Coeff(lcAtPoint / gImage.lcoeff());
+		UPolynomial hi = hImage * Coeff(lcAtPoint / hImage.lcoeff());
+		UPolynomial s(x);
+		UPolynomial t(x);
+		UPolynomial one = carl::extended_gcd(gi, hi, s, t);
+		CARL_LOG_ASSERT("carl.core.hensel", one.isOne(), "Images are expected to be coprime");
+		g = imposeLeadingCoefficient(gi, lc);
+		h = imposeLeadingCoefficient(hi, lc);
+
+		// The factors are bounded by the total degree of F in the other variables.
+		uint degree = 0;
+		for (const auto& term: F) {
+			degree = std::max(degree, term.tdeg() - (term.isConstant() ? 0 : term.monomial()->exponentOfVariable(x)));
+		}
+		for (uint d = 1; d <= degree; d++) {
+			Polynomial error = F - g * h;
+			if (error.isZero()) break;
+			// Collect the homogeneous part of degree d in the other variables as polynomials in x.
+			std::map<Monomial::Arg, std::vector<Coeff>> parts;
+			for (const auto& term: error) {
+				if (term.isConstant()) continue;
+				exponent e = term.monomial()->exponentOfVariable(x);
+				if (term.tdeg() - e != d) continue;
+				auto& coeffs = parts[term.monomial()->dropVariable(x)];
+				if (coeffs.size() <= e) coeffs.resize(e + 1, constant_zero<Coeff>::get());
+				coeffs[e] = term.coeff();
+			}
+			// Solve sigma * hi + tau * gi = c with deg(sigma) < deg(gi) for each part.
+			for (auto& part: parts) {
+				UPolynomial c(x, std::move(part.second));
+				DivisionResult<UPolynomial> sigma = (c * t).divideBy(gi);
+				UPolynomial tau = c * s + sigma.quotient * hi;
+				Polynomial m(part.first);
+				if (!sigma.remainder.isZero()) g += Polynomial(sigma.remainder) * m;
+				if (!tau.isZero()) h += Polynomial(tau) * m;
+			}
+		}
+		if (F != g * h) return false;
+		g = shift(g, point, true);
+		h = shift(h, point, true);
+		return true;
 	}
-	//{}
 };
 }
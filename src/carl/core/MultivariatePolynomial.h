@@ -65,8 +65,8 @@ public:
     using PolyType = MultivariatePolynomial<Coeff, Ordering, Policies>;
     /// The type of the cache. Multivariate polynomials do not need a cache, we set it to something.
     using CACHE = std::vector<int>;
-	/// Type our terms vector.f
-	using TermsType = std::vector<Term<Coeff>>;
+	/// Type our terms vector.
+	using TermsType = std::vector<Term<Coeff>, typename Policies::template TermAllocator<Term<Coeff>>>;
 	
 	template<typename C, typename T>
 	using EnableIfNotSame = typename std::enable_if<!std::is_same<C,T>::value,T>::type;
@@ -79,8 +79,14 @@ private:
 	/// Flag that indicates if the terms are ordered.
 	mutable bool mOrdered;
 public:
-    ///
-    static TermAdditionManager<MultivariatePolynomial,Ordering> mTermAdditionManager;
+    /**
+     * Returns the manager to add up terms. Every thread uses its own instance.
+     * @return TermAdditionManager of the current thread.
+     */
+    static TermAdditionManager<MultivariatePolynomial,Ordering>& termAdditionManager() {
+        static thread_local TermAdditionManager<MultivariatePolynomial,Ordering> manager;
+        return manager;
+    }
     
 	enum class ConstructorOperation { ADD, SUB, MUL, DIV };
     friend std::ostream& operator<<(std::ostream& os, ConstructorOperation op) {
@@ -108,7 +114,7 @@ public:
 	explicit MultivariatePolynomial(const Coeff& c);
 	explicit MultivariatePolynomial(Variable::Arg v);
 	explicit MultivariatePolynomial(const Term<Coeff>& t);
-	explicit MultivariatePolynomial(const std::shared_ptr<const Monomial>& m);
+	explicit MultivariatePolynomial(const Monomial::Arg& m);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<MultivariatePolynomial<Coeff, Ordering,Policy>> &pol);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<Coeff>& p);
 	template<class OtherPolicies, DisableIf<std::is_same<Policies,OtherPolicies>> = dummy>
@@ -727,6 +733,15 @@ private:
 	 */
 	void makeMinimallyOrdered(typename TermsType::iterator& lterm, typename TermsType::iterator& cterm) const;
 
+	/**
+	 * Checks whether dividing this polynomial by the given divisor should be done by heap division.
+	 * @param divisor Divisor.
+	 * @return If heap division should be used.
+	 */
+	bool useHeapDivision(const MultivariatePolynomial& divisor) const {
+		return !divisor.isConstant() && nrTerms() >= Policies::heapDivisionThreshold;
+	}
+
 public:
 	/**
 	 * Asserts that this polynomial complies with the requirements and assumptions for MultivariatePolynomial objects.
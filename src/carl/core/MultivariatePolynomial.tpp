@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MultivariatePolynomial.h"
+#include "HeapArithmetic.h"
 
 #include "Term.h"
 #include "UnivariatePolynomial.h"
@@ -24,9 +25,6 @@
 namespace carl
 {
 
-template<typename Coeff, typename Ordering, typename Policies>
-TermAdditionManager<MultivariatePolynomial<Coeff,Ordering,Policies>,Ordering> MultivariatePolynomial<Coeff,Ordering,Policies>::mTermAdditionManager;
-
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial():
 	mTerms(), mOrdered(true)
@@ -131,19 +129,19 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Un
 	mTerms(),
 	mOrdered(false)
 {
-	auto id = mTermAdditionManager.getId();
+	auto id = termAdditionManager().getId();
 	exponent exp = 0;
 	for (const auto& c: p.coefficients()) {
 		if (exp == 0) {
-			for (const auto& term: c) mTermAdditionManager.template addTerm<true>(id, term);
+			for (const auto& term: c) termAdditionManager().template addTerm<true>(id, term);
 		} else {
 			for (const auto& term: c * Term<Coeff>(constant_one<Coeff>::get(), p.mainVar(), exp)) {
-				mTermAdditionManager.template addTerm<true>(id, term);
+				termAdditionManager().template addTerm<true>(id, term);
 			}
 		}
 		exp++;
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
 }
@@ -186,9 +184,9 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(Multiv
 	mOrdered(ordered)
 {
 	if( duplicates ) {
-		auto id = mTermAdditionManager.getId(mTerms.size());
-		for (const auto& t: mTerms) mTermAdditionManager.template addTerm<false>(id, t);
-		mTermAdditionManager.readTerms(id, mTerms);
+		auto id = termAdditionManager().getId(mTerms.size());
+		for (const auto& t: mTerms) termAdditionManager().template addTerm<false>(id, t);
+		termAdditionManager().readTerms(id, mTerms);
 		mOrdered = false;
 	}
 
@@ -209,11 +207,11 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const
 	mOrdered(ordered)
 {
 	if( duplicates ) {
-		auto id = mTermAdditionManager.getId(mTerms.size());
+		auto id = termAdditionManager().getId(mTerms.size());
 		for (const auto& t: mTerms) {
-			mTermAdditionManager.template addTerm<false>(id, t);
+			termAdditionManager().template addTerm<false>(id, t);
 		}
-		mTermAdditionManager.readTerms(id, mTerms);
+		termAdditionManager().readTerms(id, mTerms);
 	}
 	if (!ordered) {
 		makeMinimallyOrdered();
@@ -560,16 +558,16 @@ void MultivariatePolynomial<Coeff,Ordering,Policies>::subtractProduct(const Term
 		return;
 	}
 
-	auto id = mTermAdditionManager.getId(mTerms.size() + p.mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size() + p.mTerms.size());
 	for (const auto& term: mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, term);
+		termAdditionManager().template addTerm<false>(id, term);
 	}
 	for (const auto& term: p.mTerms) {
 		Coeff c = - factor.coeff() * term.coeff();
 		auto m = factor.monomial() * term.monomial();
-		mTermAdditionManager.template addTerm<false>(id, TermType(c, m));
+		termAdditionManager().template addTerm<false>(id, TermType(c, m));
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	mOrdered = false;
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
@@ -667,27 +665,35 @@ bool MultivariatePolynomial<Coeff,Ordering,Policies>::divideBy(const Multivariat
 		quotient = MultivariatePolynomial();
 		return true;
 	}
-	auto id = mTermAdditionManager.getId(0);
-	auto thisid = mTermAdditionManager.getId(mTerms.size());
+	if (useHeapDivision(divisor)) {
+		makeOrdered();
+		divisor.makeOrdered();
+		TermsType terms;
+		if (!heapDivide<Ordering, TermsType>(mTerms, divisor.mTerms, terms, nullptr)) return false;
+		quotient = MultivariatePolynomial(std::move(terms), false, true);
+		return true;
+	}
+	auto id = termAdditionManager().getId(0);
+	auto thisid = termAdditionManager().getId(mTerms.size());
 	for (const auto& t: mTerms) {
-		mTermAdditionManager.template addTerm<false,true>(thisid, t);
+		termAdditionManager().template addTerm<false,true>(thisid, t);
 	}
 	while (true) {
-		Term<C> factor = mTermAdditionManager.getMaxTerm(thisid);
+		Term<C> factor = termAdditionManager().getMaxTerm(thisid);
 		if (factor.isZero()) break;
 		if (factor.divide(divisor.lterm(), factor)) {
 			for (const auto& t: divisor) {
-				mTermAdditionManager.template addTerm<true,true>(thisid, -factor*t);
+				termAdditionManager().template addTerm<true,true>(thisid, -factor*t);
 			}
 			//res.subtractProduct(factor, divisor);
 			//p -= factor * divisor;
-			mTermAdditionManager.template addTerm<true>(id, factor);
+			termAdditionManager().template addTerm<true>(id, factor);
 		} else {
 			return false;
 		}
 	}
-	mTermAdditionManager.readTerms(id, quotient.mTerms);
-	mTermAdditionManager.dropTerms(thisid);
+	termAdditionManager().readTerms(id, quotient.mTerms);
+	termAdditionManager().dropTerms(thisid);
 	quotient.mOrdered = false;
 	quotient.makeMinimallyOrdered<false, true>();
 	assert(quotient.isConsistent());
@@ -698,6 +704,14 @@ template<typename C, typename O, typename P>
 DivisionResult<MultivariatePolynomial<C,O,P>> MultivariatePolynomial<C,O,P>::divideBy(const MultivariatePolynomial& divisor) const
 {
 	static_assert(is_field<C>::value, "Division only defined for field coefficients");
+	if (useHeapDivision(divisor)) {
+		makeOrdered();
+		divisor.makeOrdered();
+		TermsType q;
+		TermsType r;
+		heapDivide<O, TermsType>(mTerms, divisor.mTerms, q, &r);
+		return DivisionResult<MultivariatePolynomial<C,O,P>>(MultivariatePolynomial(std::move(q), false, true), MultivariatePolynomial(std::move(r), false, true));
+	}
 	MultivariatePolynomial<C,O,P> q;
 	MultivariatePolynomial<C,O,P> r;
 	MultivariatePolynomial p = *this;
@@ -735,14 +749,14 @@ MultivariatePolynomial<C,O,P> MultivariatePolynomial<C,O,P>::quotient(const Mult
 	}
 	//static_assert(is_field<C>::value, "Division only defined for field coefficients");
 	MultivariatePolynomial p(*this);
-	auto id = mTermAdditionManager.getId(p.mTerms.size());
+	auto id = termAdditionManager().getId(p.mTerms.size());
 	while(!p.isZero())
 	{
 		Term<C> factor;
 		if (p.lterm().divide(divisor.lterm(), factor)) {
 			//p -= factor * divisor;
 			p.subtractProduct(factor, divisor);
-			mTermAdditionManager.template addTerm<true>(id, factor);
+			termAdditionManager().template addTerm<true>(id, factor);
 		}
 		else
 		{
@@ -750,7 +764,7 @@ MultivariatePolynomial<C,O,P> MultivariatePolynomial<C,O,P>::quotient(const Mult
 		}
 	}
 	MultivariatePolynomial<C,O,P> result;
-	mTermAdditionManager.readTerms(id, result.mTerms);
+	termAdditionManager().readTerms(id, result.mTerms);
 	result.mOrdered = false;
 	result.makeMinimallyOrdered<false, true>();
 	assert(result.isConsistent());
@@ -767,6 +781,14 @@ MultivariatePolynomial<C,O,P> MultivariatePolynomial<C,O,P>::remainder(const Mul
 	{
 		return MultivariatePolynomial<C,O,P>();
 	}
+	if (useHeapDivision(divisor)) {
+		makeOrdered();
+		divisor.makeOrdered();
+		TermsType q;
+		TermsType r;
+		heapDivide<O, TermsType>(mTerms, divisor.mTerms, q, &r);
+		return MultivariatePolynomial(std::move(r), false, true);
+	}
 
 	MultivariatePolynomial<C,O,P> remainder;
 	MultivariatePolynomial p = *this;
@@ -894,11 +916,11 @@ void MultivariatePolynomial<Coeff,Ordering,Policies>::substituteIn(Variable::Arg
 		}
 	}
 	// Substitute the variable.
-	auto id = mTermAdditionManager.getId(expectedResultSize);
+	auto id = termAdditionManager().getId(expectedResultSize);
 	for (const auto& term: mTerms)
 	{
 		if (term.monomial() == nullptr) {
-			mTermAdditionManager.template addTerm<false>(id, term);
+			termAdditionManager().template addTerm<false>(id, term);
 		} else {
 			exponent e = term.monomial()->exponentOfVariable(var);
 			Monomial::Arg mon;
@@ -906,27 +928,27 @@ void MultivariatePolynomial<Coeff,Ordering,Policies>::substituteIn(Variable::Arg
 			if (e == 1) {
 				for(auto vterm : value.mTerms)
 				{
-					if (mon == nullptr) mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
-					else if (vterm.monomial() == nullptr) mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
-					else mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
+					if (mon == nullptr) termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
+					else if (vterm.monomial() == nullptr) termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
+					else termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
 				}
 			} else if(e > 1) {
 				auto iter = expResults.find(e);
 				assert(iter != expResults.end());
 				for(auto vterm : iter->second.first.mTerms)
 				{
-					if (mon == nullptr) mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
-					else if (vterm.monomial() == nullptr) mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
-					else mTermAdditionManager.template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
+					if (mon == nullptr) termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial()));
+					else if (vterm.monomial() == nullptr) termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), mon));
+					else termAdditionManager().template addTerm<false>(id, Term<Coeff>(vterm.coeff() * term.coeff(), vterm.monomial() * mon));
 				}
 			}
 			else
 			{
-				mTermAdditionManager.template addTerm<false>(id, term);
+				termAdditionManager().template addTerm<false>(id, term);
 			}
 		}
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
     mOrdered = false;
     makeMinimallyOrdered<false, true>();
 	assert(mTerms.size() <= expectedResultSize);
@@ -1068,15 +1090,15 @@ MultivariatePolynomial<Coeff,Ordering,Policies> MultivariatePolynomial<Coeff,Ord
 {
     static_assert(!std::is_same<SubstitutionType, Term<Coeff>>::value, "Terms are handled by a seperate method.");
 	MultivariatePolynomial result;
-	auto id = mTermAdditionManager.getId(mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size());
 	for (const auto& term: mTerms) {
         Term<Coeff> resultTerm = term.substitute(substitutions);
         if( !resultTerm.isZero() )
         {
-            mTermAdditionManager.template addTerm<false>(id, resultTerm );
+            termAdditionManager().template addTerm<false>(id, resultTerm );
         }
 	}
-	mTermAdditionManager.readTerms(id, result.mTerms);
+	termAdditionManager().readTerms(id, result.mTerms);
 	result.mOrdered = false;
     result.makeMinimallyOrdered<false, true>();
 	assert(result.isConsistent());
@@ -1087,11 +1109,11 @@ template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff, Ordering, Policies> MultivariatePolynomial<Coeff, Ordering, Policies>::substitute(const std::map<Variable, Term<Coeff>>& substitutions) const
 {
 	MultivariatePolynomial result;
-	auto id = mTermAdditionManager.getId(mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size());
 	for (const auto& term: mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, term.substitute(substitutions));
+		termAdditionManager().template addTerm<false>(id, term.substitute(substitutions));
 	}
-	mTermAdditionManager.readTerms(id, result.mTerms);
+	termAdditionManager().readTerms(id, result.mTerms);
 	result.mOrdered = false;
 	result.makeMinimallyOrdered<false, true>();
 	assert(result.isConsistent());
@@ -1237,17 +1259,17 @@ template<typename Coeff, typename Ordering, typename Policies>
 void MultivariatePolynomial<Coeff,Ordering,Policies>::square()
 {
 	assert(this->isConsistent());
-	auto id = mTermAdditionManager.getId(mTerms.size() * mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size() * mTerms.size());
 	Term<Coeff> newlterm;
 	for (auto it1 = mTerms.rbegin(); it1 != mTerms.rend(); it1++) {
 		if (it1 == mTerms.rbegin()) newlterm = it1->pow(2);
-		else mTermAdditionManager.template addTerm<false>(id, it1->pow(2));
+		else termAdditionManager().template addTerm<false>(id, it1->pow(2));
 		for (auto it2 = it1+1; it2 != mTerms.rend(); it2++) {
-			mTermAdditionManager.template addTerm<false>(id, Coeff(2) * *it1 * *it2);
+			termAdditionManager().template addTerm<false>(id, Coeff(2) * *it1 * *it2);
 		}
 	}
 	mOrdered = false;
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	if (!newlterm.isZero()) mTerms.push_back(newlterm);
 	assert(this->isConsistent());
 }
@@ -1362,12 +1384,12 @@ UnivariatePolynomial<MultivariatePolynomial<C,O,P>> MultivariatePolynomial<C,O,P
 			if (exponent >= coeffs.size()) {
 				coeffs.resize(exponent + 1);
 			}
-			std::shared_ptr<const carl::Monomial> tmp = mon->dropVariable(v);
+			Monomial::Arg tmp = mon->dropVariable(v);
 			coeffs[exponent] += term.coeff() * tmp;
 		}
 	}
 	// Convert result back to MultivariatePolynomial and check that the result is equal to *this
-	assert(MultivariatePolynomial<C>(UnivariatePolynomial<MultivariatePolynomial<C,O,P>>(v, coeffs)) == *this);
+	assert(MultivariatePolynomial(UnivariatePolynomial<MultivariatePolynomial<C,O,P>>(v, coeffs)) == *this);
 	return UnivariatePolynomial<MultivariatePolynomial<C,O,P>>(v, coeffs);
 }
 
@@ -1441,7 +1463,7 @@ bool operator==(const MultivariatePolynomial<C,O,P>& lhs, const Term<C>& rhs) {
 }
 
 template<typename C, typename O, typename P>
-bool operator==(const MultivariatePolynomial<C,O,P>& lhs, const std::shared_ptr<const carl::Monomial>& rhs) {
+bool operator==(const MultivariatePolynomial<C,O,P>& lhs, const Monomial::Arg& rhs) {
 	if (lhs.nrTerms() != 1) return false;
 	if (lhs.lmon() == nullptr) return false;
 	return lhs.lmon() == rhs;
@@ -1514,7 +1536,7 @@ bool operator<(const MultivariatePolynomial<C,O,P>& lhs, const Term<C>& rhs) {
 	return (lhs.lterm()) < rhs;
 }
 template<typename C, typename O, typename P>
-bool operator<(const MultivariatePolynomial<C,O,P>& lhs, const std::shared_ptr<const carl::Monomial>& rhs) {
+bool operator<(const MultivariatePolynomial<C,O,P>& lhs, const Monomial::Arg& rhs) {
 	if (lhs.nrTerms() == 0) return true;
 	return (lhs.lterm()) < rhs;
 }
@@ -1536,7 +1558,7 @@ bool operator<(const Term<C>& lhs, const MultivariatePolynomial<C,O,P>& rhs) {
 	return false;
 }
 template<typename C, typename O, typename P>
-bool operator<(const std::shared_ptr<const carl::Monomial>& lhs, const MultivariatePolynomial<C,O,P>& rhs) {
+bool operator<(const Monomial::Arg& lhs, const MultivariatePolynomial<C,O,P>& rhs) {
 	if (rhs.nrTerms() == 0) return false;
 	if (lhs < (rhs.lterm())) return true;
 	if (lhs == (rhs.lterm())) return rhs.nrTerms() > 1;
@@ -1589,14 +1611,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         mTerms.pop_back();
 		--rhsEnd;
 	}
-	auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size() + rhs.mTerms.size());
 	for (auto termIter = mTerms.begin(); termIter != mTerms.end(); ++termIter) {
-		mTermAdditionManager.template addTerm<false,false>(id, *termIter);
+		termAdditionManager().template addTerm<false,false>(id, *termIter);
 	}
 	for (auto termIter = rhs.mTerms.begin(); termIter != rhsEnd; ++termIter) {
-		mTermAdditionManager.template addTerm<false,false>(id, *termIter);
+		termAdditionManager().template addTerm<false,false>(id, *termIter);
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	if (newlterm.isZero()) {
 		makeMinimallyOrdered<false,true>();
 	} else {
@@ -1653,12 +1675,12 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 		mTerms.push_back(rhs);
 	} else {
 		// Full-blown addition.
-		auto id = mTermAdditionManager.getId(mTerms.size()+1);
+		auto id = termAdditionManager().getId(mTerms.size()+1);
 		for (const auto& term: mTerms) {
-			mTermAdditionManager.template addTerm<false>(id, term);
+			termAdditionManager().template addTerm<false>(id, term);
 		}
-		mTermAdditionManager.template addTerm<false>(id, rhs);
-		mTermAdditionManager.readTerms(id, mTerms);
+		termAdditionManager().template addTerm<false>(id, rhs);
+		termAdditionManager().readTerms(id, mTerms);
 		makeMinimallyOrdered<false, true>();
 		mOrdered = false;
 	}
@@ -1788,14 +1810,14 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 		return *this += c;
 	}
 
-	auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+	auto id = termAdditionManager().getId(mTerms.size() + rhs.mTerms.size());
 	for (const auto& term: mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, term);
+		termAdditionManager().template addTerm<false>(id, term);
 	}
 	for (const auto& term: rhs.mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, -term);
+		termAdditionManager().template addTerm<false>(id, -term);
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	mOrdered = false;
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
@@ -1939,7 +1961,17 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 		*this = rhs;
 		return *this *= c;
 	}
-	auto id = mTermAdditionManager.getId(mTerms.size() * rhs.mTerms.size());
+	if (std::min(mTerms.size(), rhs.mTerms.size()) >= Policies::heapMultiplicationThreshold) {
+		makeOrdered();
+		rhs.makeOrdered();
+		TermsType terms;
+		heapMultiply<Ordering, TermsType>(mTerms, rhs.mTerms, terms);
+		mTerms = std::move(terms);
+		mOrdered = true;
+		assert(this->isConsistent());
+		return *this;
+	}
+	auto id = termAdditionManager().getId(mTerms.size() * rhs.mTerms.size());
 	TermType newlterm;
 	bool first = true;
 	for (auto t1 = mTerms.rbegin(); t1 != mTerms.rend(); t1++) {
@@ -1947,10 +1979,10 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 			if (first) {
 				newlterm = *t1 * *t2;
 				first = false;
-			} else mTermAdditionManager.template addTerm<false>(id, std::move((*t1)*(*t2)));
+			} else termAdditionManager().template addTerm<false>(id, std::move((*t1)*(*t2)));
 		}
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	termAdditionManager().readTerms(id, mTerms);
 	if (newlterm.isZero()) makeMinimallyOrdered<false, true>();
 	else mTerms.push_back(newlterm);
 	//makeMinimallyOrdered<false, true>();
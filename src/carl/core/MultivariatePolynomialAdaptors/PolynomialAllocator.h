@@ -1,4 +1,4 @@
-/** 
+/**
  * @file:   PolynomialAllocator.h
  * @author: Sebastian Junges
  *
@@ -7,10 +7,291 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
 namespace carl
 {
+
+/**
+ * A per-thread bump arena.
+ *
+ * Memory is taken from large chunks by simply advancing a pointer. Every chunk counts the allocations that are still
+ * alive and is freed as soon as this count drops to zero. If all allocations from the current chunk of a thread have
+ * been freed, the chunk is reused from its beginning.
+ * Memory may be freed by any thread, but is only allocated from the chunks of the calling thread.
+ */
+class BumpArena {
+public:
+	/// Size of a regular chunk in bytes.
+	static constexpr std::size_t ChunkSize = 1 << 16;
+	/// Allocations larger than this get a chunk of their own.
+	static constexpr std::size_t MaxArenaAllocation = ChunkSize / 4;
+private:
+	static constexpr std::size_t Alignment = alignof(std::max_align_t);
+	static constexpr std::size_t align(std::size_t bytes) {
+		return (bytes + Alignment - 1) / Alignment * Alignment;
+	}
+	struct Chunk {
+		/// Number of live allocations, plus one while this is the current chunk of some thread.
+		std::atomic<std::size_t> references;
+		/// Usable size in bytes.
+		std::size_t size;
+		/// Bytes already handed out.
+		std::size_t used;
+		char* data() {
+			return reinterpret_cast<char*>(this) + align(sizeof(Chunk));
+		}
+	};
+	/// Prefix of every allocation to find the owning chunk.
+	struct alignas(Alignment) Header {
+		Chunk* chunk;
+	};
+	/// Per-thread state. It is trivially destructible and thus stays accessible during thread shutdown.
+	struct State {
+		Chunk* current;
+		bool closed;
+	};
+	/// Releases the current chunk when the thread terminates.
+	struct Cleaner {
+		~Cleaner() {
+			State& s = state();
+			if (s.current != nullptr) release(s.current);
+			s.current = nullptr;
+			s.closed = true;
+		}
+	};
+
+	static State& state() {
+		static thread_local State s = { nullptr, false };
+		return s;
+	}
+	static Chunk* newChunk(std::size_t size, std::size_t references) {
+		void* memory = ::operator new(align(sizeof(Chunk)) + size);
+		Chunk* c = new (memory) Chunk();
+		c->references = references;
+		c->size = size;
+		c->used = 0;
+		return c;
+	}
+	static void release(Chunk* c) {
+		if (--c->references == 0) {
+			c->~Chunk();
+			::operator delete(c);
+		}
+	}
+	static void* place(Chunk* c, std::size_t needed) {
+		char* p = c->data() + c->used;
+		c->used += needed;
+		reinterpret_cast<Header*>(p)->chunk = c;
+		return p + sizeof(Header);
+	}
+public:
+	/**
+	 * Allocates memory that is aligned for every scalar type.
+	 * @param bytes Number of bytes.
+	 * @return Pointer to the memory.
+	 */
+	static void* allocate(std::size_t bytes) {
+		std::size_t needed = sizeof(Header) + align(bytes);
+		State& s = state();
+		if (bytes > MaxArenaAllocation || s.closed) {
+			return place(newChunk(needed, 1), needed);
+		}
+		static thread_local Cleaner cleaner;
+		(void)cleaner;
+		if (s.current != nullptr && s.current->references.load() == 1) {
+			// Only the thread itself refers to this chunk, hence everything can be reused.
+			s.current->used = 0;
+		}
+		if (s.current == nullptr || s.current->used + needed > s.current->size) {
+			if (s.current != nullptr) release(s.current);
+			s.current = newChunk(ChunkSize, 1);
+		}
+		++s.current->references;
+		return place(s.current, needed);
+	}
+	/**
+	 * Frees memory obtained from allocate().
+	 * @param p Pointer to the memory.
+	 */
+	static void deallocate(void* p) {
+		release(reinterpret_cast<Header*>(static_cast<char*>(p) - sizeof(Header))->chunk);
+	}
+};
+
+/**
+ * A per-thread pool of blocks, organized in size classes of powers of two.
+ *
+ * Freed blocks are kept in a free list of the freeing thread and are reused for later allocations of the same size class.
+ * The number of cached blocks per class is bounded, large blocks are not cached at all.
+ */
+class SizeClassPool {
+public:
+	/// Size of the smallest size class in bytes.
+	static constexpr std::size_t MinBlockSize = 16;
+	/// Number of size classes, the largest class holds MinBlockSize * 2^(NumClasses-1) bytes.
+	static constexpr std::size_t NumClasses = 10;
+	/// Number of blocks that are kept per size class.
+	static constexpr std::size_t MaxCachedBlocks = 256;
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+	/// Per-thread state. It is trivially destructible and thus stays accessible during thread shutdown.
+	struct State {
+		FreeBlock* free[NumClasses];
+		std::size_t cached[NumClasses];
+		bool closed;
+	};
+	/// Frees all cached blocks when the thread terminates.
+	struct Cleaner {
+		~Cleaner() {
+			State& s = state();
+			for (std::size_t c = 0; c < NumClasses; c++) {
+				while (s.free[c] != nullptr) {
+					FreeBlock* b = s.free[c];
+					s.free[c] = b->next;
+					::operator delete(b);
+				}
+				s.cached[c] = 0;
+			}
+			s.closed = true;
+		}
+	};
+
+	static State& state() {
+		static thread_local State s = {};
+		return s;
+	}
+	static std::size_t sizeClass(std::size_t bytes) {
+		std::size_t c = 0;
+		for (std::size_t size = MinBlockSize; size < bytes; size *= 2) c++;
+		return c;
+	}
+public:
+	/**
+	 * Allocates memory that is aligned for every scalar type.
+	 * @param bytes Number of bytes.
+	 * @return Pointer to the memory.
+	 */
+	static void* allocate(std::size_t bytes) {
+		std::size_t c = sizeClass(bytes);
+		if (c >= NumClasses) return ::operator new(bytes);
+		State& s = state();
+		if (s.free[c] != nullptr) {
+			FreeBlock* b = s.free[c];
+			s.free[c] = b->next;
+			s.cached[c]--;
+			return b;
+		}
+		return ::operator new(MinBlockSize << c);
+	}
+	/**
+	 * Frees memory obtained from allocate().
+	 * @param p Pointer to the memory.
+	 * @param bytes Number of bytes that were requested.
+	 */
+	static void deallocate(void* p, std::size_t bytes) {
+		std::size_t c = sizeClass(bytes);
+		if (c >= NumClasses) {
+			::operator delete(p);
+			return;
+		}
+		State& s = state();
+		if (s.closed || s.cached[c] >= MaxCachedBlocks) {
+			::operator delete(p);
+			return;
+		}
+		static thread_local Cleaner cleaner;
+		(void)cleaner;
+		FreeBlock* b = static_cast<FreeBlock*>(p);
+		b->next = s.free[c];
+		s.free[c] = b;
+		s.cached[c]++;
+	}
+};
+
+/**
+ * Standard conforming allocator that uses BumpArena.
+ */
+template<typename T>
+struct BumpArenaAllocator {
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported.");
+	using value_type = T;
+	BumpArenaAllocator() = default;
+	template<typename U>
+	BumpArenaAllocator(const BumpArenaAllocator<U>&) {}
+	T* allocate(std::size_t n) {
+		return static_cast<T*>(BumpArena::allocate(n * sizeof(T)));
+	}
+	void deallocate(T* p, std::size_t) {
+		BumpArena::deallocate(p);
+	}
+};
+template<typename T, typename U>
+bool operator==(const BumpArenaAllocator<T>&, const BumpArenaAllocator<U>&) {
+	return true;
+}
+template<typename T, typename U>
+bool operator!=(const BumpArenaAllocator<T>&, const BumpArenaAllocator<U>&) {
+	return false;
+}
+
+/**
+ * Standard conforming allocator that uses SizeClassPool.
+ */
+template<typename T>
+struct SizeClassPoolAllocator {
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported.");
+	using value_type = T;
+	SizeClassPoolAllocator() = default;
+	template<typename U>
+	SizeClassPoolAllocator(const SizeClassPoolAllocator<U>&) {}
+	T* allocate(std::size_t n) {
+		return static_cast<T*>(SizeClassPool::allocate(n * sizeof(T)));
+	}
+	void deallocate(T* p, std::size_t n) {
+		SizeClassPool::deallocate(p, n * sizeof(T));
+	}
+};
+template<typename T, typename U>
+bool operator==(const SizeClassPoolAllocator<T>&, const SizeClassPoolAllocator<U>&) {
+	return true;
+}
+template<typename T, typename U>
+bool operator!=(const SizeClassPoolAllocator<T>&, const SizeClassPoolAllocator<U>&) {
+	return false;
+}
+
+/**
+ * Allocator policy: the terms of a polynomial are stored using std::allocator.
+ */
 struct NoAllocator
 {
-	
+	template<typename T>
+	using allocator = std::allocator<T>;
+};
+
+/**
+ * Allocator policy: the terms of a polynomial are stored in the BumpArena of the current thread.
+ * Suited for many short-lived temporaries, as for example in chains of substitutions or resultants.
+ */
+struct ArenaAllocator
+{
+	template<typename T>
+	using allocator = BumpArenaAllocator<T>;
+};
+
+/**
+ * Allocator policy: the terms of a polynomial are stored in blocks of the SizeClassPool of the current thread.
+ */
+struct PoolAllocator
+{
+	template<typename T>
+	using allocator = SizeClassPoolAllocator<T>;
 };
-}
\ No newline at end of file
+}
@@ -26,9 +26,24 @@ namespace carl
          * Although the worst-case complexity is worse, for polynomials with a small nr of terms, this should be better.
          */
         static const bool searchLinear = true;
+
+        /**
+         * Products of two polynomials that both have at least this many terms are computed by heap multiplication.
+         * Smaller products are collected in the TermAdditionManager.
+         */
+        static const std::size_t heapMultiplicationThreshold = 32;
+        /**
+         * Divisions of a polynomial with at least this many terms by a non-constant polynomial are computed by heap division.
+         * Otherwise the dividend is reduced term by term.
+         */
+        static const std::size_t heapDivisionThreshold = 4;
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
+
+		/// Allocator for the terms of a polynomial, see PolynomialAllocator.h.
+		template<typename T>
+		using TermAllocator = typename Allocator::template allocator<T>;
 		
 		//typedef typename ReasonsAdaptor::ReasonsType ReasonsType;
 		
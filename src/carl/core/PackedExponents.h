@@ -0,0 +1,157 @@
+/**
+ * @file PackedExponents.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+#include "CompareResult.h"
+#include "Variable.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+	/**
+	 * A dense representation of the exponent vector of a monomial.
+	 *
+	 * The exponents are stored as 8-bit lanes within 64-bit words, allowing to implement divisibility checks
+	 * and lexical comparison as word-parallel (SWAR) operations.
+	 * The most significant bit of every lane serves as guard bit, hence exponents are limited to MaxExponent.
+	 *
+	 * Only a bounded number of variables can be represented: a variable is mapped to a lane if it has rank zero,
+	 * is real or integer and has a small id. Lanes are ordered like the variables, the smallest variable being stored
+	 * in the most significant lane of the first word. Thus comparing the words as integers yields the lexical order.
+	 *
+	 * If some monomial can not be packed, the resulting object is invalid and all users fall back to the
+	 * sparse representation in Monomial::Content.
+	 * @ingroup multirp
+	 */
+	class PackedExponents {
+	public:
+		/// Number of words.
+		static constexpr std::size_t Words = 4;
+		/// Number of lanes within a single word.
+		static constexpr std::size_t LanesPerWord = 8;
+		/// Overall number of lanes.
+		static constexpr std::size_t Lanes = Words * LanesPerWord;
+		/// Largest exponent that can be stored.
+		static constexpr uint MaxExponent = 127;
+	private:
+		/// Mask for the guard bits of all lanes.
+		static constexpr std::uint64_t Guard = 0x8080808080808080ull;
+		/// Mask for the lowest bit of all lanes.
+		static constexpr std::uint64_t Low = 0x0101010101010101ull;
+
+		std::array<std::uint64_t, Words> mWords = {};
+		bool mValid = false;
+
+		/**
+		 * Returns the value of the given lane within a word.
+		 * @param word Word.
+		 * @param lane Lane within the word.
+		 * @return Exponent stored in this lane.
+		 */
+		static uint laneValue(std::uint64_t word, std::size_t lane) {
+			return uint((word >> ((LanesPerWord - 1 - lane) * 8)) & 0xFF);
+		}
+	public:
+		/**
+		 * Determines the lane of the given variable.
+		 * @param v Variable.
+		 * @return Lane of v or Lanes, if v can not be packed.
+		 */
+		static std::size_t lane(Variable v) {
+			if (v.rank() != 0) return Lanes;
+			if (v.type() != VariableType::VT_REAL && v.type() != VariableType::VT_INT) return Lanes;
+			if (v.id() == 0 || v.id() > Lanes / 2) return Lanes;
+			return (v.id() - 1) * 2 + (v.type() == VariableType::VT_INT ? 1 : 0);
+		}
+
+		/**
+		 * Packs the given exponent vector.
+		 * @param content Variables and exponents, sorted by variables.
+		 * @return Packed representation, invalid if some variable or exponent can not be packed.
+		 */
+		static PackedExponents pack(const std::vector<std::pair<Variable, uint>>& content) {
+			PackedExponents res;
+			for (const auto& ve: content) {
+				std::size_t l = lane(ve.first);
+				if (l == Lanes || ve.second > MaxExponent) return PackedExponents();
+				res.mWords[l / LanesPerWord] |= std::uint64_t(ve.second) << ((LanesPerWord - 1 - l % LanesPerWord) * 8);
+			}
+			res.mValid = true;
+			return res;
+		}
+
+		bool valid() const {
+			return mValid;
+		}
+		const std::array<std::uint64_t, Words>& words() const {
+			return mWords;
+		}
+
+		/**
+		 * Checks whether lhs is divisible by rhs.
+		 * Assumes that both are valid.
+		 */
+		static bool divisible(const PackedExponents& lhs, const PackedExponents& rhs) {
+			assert(lhs.valid() && rhs.valid());
+			for (std::size_t w = 0; w < Words; w++) {
+				if ((((lhs.mWords[w] | Guard) - rhs.mWords[w]) & Guard) != Guard) return false;
+			}
+			return true;
+		}
+		/**
+		 * Checks whether lhs and rhs share no variable.
+		 * Assumes that both are valid.
+		 */
+		static bool coprime(const PackedExponents& lhs, const PackedExponents& rhs) {
+			assert(lhs.valid() && rhs.valid());
+			for (std::size_t w = 0; w < Words; w++) {
+				std::uint64_t l = ((lhs.mWords[w] | Guard) - Low) & Guard;
+				std::uint64_t r = ((rhs.mWords[w] | Guard) - Low) & Guard;
+				if ((l & r) != 0) return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Lexical comparison, consistent with Monomial::lexicalCompare().
+		 * A larger exponent of a smaller variable makes a monomial smaller.
+		 * If one monomial is a proper prefix of the other, the shorter one is smaller.
+		 * Assumes that both are valid.
+		 */
+		static CompareResult lexicalCompare(const PackedExponents& lhs, const PackedExponents& rhs) {
+			assert(lhs.valid() && rhs.valid());
+			std::size_t w = 0;
+			while (w < Words && lhs.mWords[w] == rhs.mWords[w]) w++;
+			if (w == Words) return CompareResult::EQUAL;
+			std::size_t l = 0;
+			while (laneValue(lhs.mWords[w], l) == laneValue(rhs.mWords[w], l)) l++;
+			bool lhsLarger = laneValue(lhs.mWords[w], l) > laneValue(rhs.mWords[w], l);
+			const PackedExponents& smaller = lhsLarger ? rhs : lhs;
+			// Check if the monomial with the smaller exponent has no more variables.
+			std::uint64_t remainder = smaller.mWords[w] << (l * 8);
+			bool exhausted = remainder == 0;
+			for (std::size_t i = w + 1; exhausted && i < Words; i++) {
+				exhausted = smaller.mWords[i] == 0;
+			}
+			if (exhausted) {
+				return lhsLarger ? CompareResult::GREATER : CompareResult::LESS;
+			}
+			return lhsLarger ? CompareResult::LESS : CompareResult::GREATER;
+		}
+
+		bool operator==(const PackedExponents& rhs) const {
+			return mValid == rhs.mValid && mWords == rhs.mWords;
+		}
+		bool operator!=(const PackedExponents& rhs) const {
+			return !(*this == rhs);
+		}
+	};
+}
@@ -1607,7 +1607,9 @@ bool operator==(const UnivariatePolynomial<C>& lhs, const UnivariatePolynomial<C
 		// in different variables, polynomials can still be equal if constant.
 		if(lhs.isZero() && rhs.isZero()) return true;
 		if(lhs.isConstant() && rhs.isConstant() && lhs.lcoeff() == rhs.lcoeff()) return true;
-		return MultivariatePolynomial<typename carl::UnderlyingNumberType<C>::type>(lhs) == MultivariatePolynomial<typename carl::UnderlyingNumberType<C>::type>(rhs);
+		// Polynomial coefficients are converted to their own type, thereby keeping their ordering and policies.
+		using MPoly = typename std::conditional<std::is_constructible<C, const UnivariatePolynomial<C>&>::value, C, MultivariatePolynomial<typename carl::UnderlyingNumberType<C>::type>>::type;
+		return MPoly(lhs) == MPoly(rhs);
 	}
 }
 template<typename C>
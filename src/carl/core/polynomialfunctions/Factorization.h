@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../logging.h"
+#include "Factorization_multivariate.h"
+#include "Factorization_univariate.h"
 #include "../../converter/CoCoAAdaptor.h"
 #include "../../converter/OldGinacConverter.h"
 #include "../../numbers/FunctionSelector.h"
@@ -20,6 +22,26 @@ namespace helper {
 		return { std::make_pair(p, 1) };
 	}
 	
+	/**
+	 * Factorizes a polynomial using the native univariate or multivariate factorization.
+	 */
+	template<typename C, typename O, typename P>
+	Factors<MultivariatePolynomial<C,O,P>> nativeFactorization(const MultivariatePolynomial<C,O,P>& p, bool includeConstants) {
+		Factors<MultivariatePolynomial<C,O,P>> res;
+		if (p.gatherVariables().size() == 1) {
+			for (const auto& f: carl::factorization(p.toUnivariatePolynomial())) {
+				if (!includeConstants && f.first.isConstant()) continue;
+				res.emplace(MultivariatePolynomial<C,O,P>(f.first), f.second);
+			}
+			return res;
+		}
+		for (const auto& f: multivariate_factorization::factor(p)) {
+			if (!includeConstants && f.first.isConstant()) continue;
+			res.insert(f);
+		}
+		return res;
+	}
+
 	template<typename C, typename O, typename P>
 	void sanitizeFactors(const MultivariatePolynomial<C,O,P>& reference, Factors<MultivariatePolynomial<C,O,P>>& factors) {
 		MultivariatePolynomial<C,O,P> p(1);
@@ -49,6 +71,7 @@ namespace helper {
 /**
  * Try to factorize a multivariate polynomial..
  * Uses CoCoALib and GiNaC, if available, depending on the coefficient type of the polynomial.
+ * Otherwise, polynomials with rational coefficients are factorized natively.
  */
 template<typename C, typename O, typename P>
 Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomial<C,O,P>& p, bool includeConstants = true) {
@@ -70,7 +93,7 @@ Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomia
 		[includeConstants](const auto& p){ CoCoAAdaptor<MultivariatePolynomial<C,O,P>> c({p}); return c.factorize(p, includeConstants); }
 	#else
 		[includeConstants](const auto& p){ return helper::trivialFactorization(p); },
-		[includeConstants](const auto& p){ return helper::trivialFactorization(p); }
+		[includeConstants](const auto& p){ return helper::nativeFactorization(p, includeConstants); }
 	#endif
 	#if defined USE_GINAC
 		,
@@ -107,7 +130,11 @@ std::vector<MultivariatePolynomial<C,O,P>> irreducibleFactors(const Multivariate
 		[includeConstants](const auto& p){ CoCoAAdaptor<MultivariatePolynomial<C,O,P>> c({p}); return c.irreducibleFactors(p, includeConstants); }
 	#else
 		[includeConstants](const auto& p){ return std::vector<MultivariatePolynomial<C,O,P>>({p}); },
-		[includeConstants](const auto& p){ return std::vector<MultivariatePolynomial<C,O,P>>({p}); }
+		[includeConstants](const auto& p){
+			std::vector<MultivariatePolynomial<C,O,P>> res;
+			for (const auto& f: helper::nativeFactorization(p, includeConstants)) res.push_back(f.first);
+			return res;
+		}
 	#endif
 	#if defined USE_GINAC
 		,
@@ -0,0 +1,193 @@
+/**
+ * @file Factorization_multivariate.h
+ *
+ * Implements the factorization of multivariate polynomials over the rationals.
+ * The polynomial is evaluated at a point for all but one variable, the univariate image is factored and
+ * the factors are lifted by multivariate Hensel lifting with imposed leading coefficients @cite Wang78 .
+ */
+
+#pragma once
+
+#include "../logging.h"
+#include "../MultivariateGCD.h"
+#include "../MultivariateHensel.h"
+#include "../MultivariatePolynomial.h"
+#include "../../util/Common.h"
+#include "ModularFactorization.h"
+
+#include <random>
+
+namespace carl {
+
+namespace multivariate_factorization {
+
+	/// Number of suitable evaluation points that are tried, the one with the fewest univariate factors is used.
+	static constexpr std::size_t CandidatePoints = 3;
+
+	/// Returns the polynomial with coprime integral coefficients and positive leading coefficient.
+	template<typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> normalize(const MultivariatePolynomial<C,O,P>& p) {
+		return p.coprimeCoefficients();
+	}
+
+	/// Computes the content of p with respect to x, that is the gcd of its coefficients.
+	template<typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> content(const MultivariatePolynomial<C,O,P>& p, Variable x) {
+		MultivariatePolynomial<C,O,P> res;
+		auto coeffs = p.toUnivariatePolynomial(x);
+		for (const auto& c: coeffs.coefficients()) {
+			if (c.isZero()) continue;
+			res = res.isZero() ? normalize(c) : carl::gcd(res, c);
+			if (res.isConstant()) break;
+		}
+		return res;
+	}
+
+	/// Evaluates all variables but x at the given point.
+	template<typename C, typename O, typename P>
+	UnivariatePolynomial<C> evaluate(const MultivariatePolynomial<C,O,P>& p, Variable x, const std::map<Variable, C>& point) {
+		MultivariatePolynomial<C,O,P> res = p.substitute(point);
+		if (res.isConstant()) return UnivariatePolynomial<C>(x, res.constantPart());
+		return res.toUnivariatePolynomial();
+	}
+
+	/**
+	 * Computes the irreducible factors of a polynomial that is square-free and primitive with respect to x.
+	 * The factors are normalized.
+	 */
+	template<typename C, typename O, typename P>
+	std::vector<MultivariatePolynomial<C,O,P>> irreducible(const MultivariatePolynomial<C,O,P>& f, Variable x, std::mt19937& rng) {
+		using Poly = MultivariatePolynomial<C,O,P>;
+		using UPoly = UnivariatePolynomial<C>;
+		assert(f.degree(x) > 0);
+		std::vector<Variable> others;
+		for (auto v: f.gatherVariables()) {
+			if (v != x) others.push_back(v);
+		}
+		if (others.empty()) {
+			std::vector<Poly> res;
+			for (const auto& g: modular_factorization::factor(f.toUnivariatePolynomial())) res.emplace_back(g);
+			return res;
+		}
+		if (f.degree(x) == 1) return {normalize(f)};
+
+		// Choose a point such that the image stays square-free with the same degree and has few factors.
+		Poly lc = f.lcoeff(x);
+		std::map<Variable, C> point;
+		std::vector<UPoly> images;
+		std::size_t candidates = 0;
+		sint bound = 2;
+		for (std::size_t tries = 0; candidates < CandidatePoints; tries++) {
+			if (tries > 0 && tries % 16 == 0) bound *= 2;
+			std::uniform_int_distribution<sint> dist(-bound, bound);
+			std::map<Variable, C> candidate;
+			for (auto v: others) candidate.emplace(v, C(dist(rng)));
+			if (isZero(lc.substitute(candidate).constantPart())) continue;
+			UPoly image = evaluate(f, x, candidate);
+			if (!modular_gcd::compute(image, image.derivative()).isConstant()) continue;
+			candidates++;
+			std::vector<UPoly> factors = modular_factorization::factor(image);
+			CARL_LOG_DEBUG("carl.core.factorize", "Found " << factors.size() << " univariate factors at " << candidate);
+			if (point.empty() || factors.size() < images.size()) {
+				point = std::move(candidate);
+				images = std::move(factors);
+			}
+			if (images.size() == 1) return {normalize(f)};
+		}
+
+		// Lift the images to true factors, trying the subsets of images in increasing size.
+		std::vector<Poly> res;
+		Poly rest = f;
+		std::size_t size = 1;
+		while (2 * size <= images.size()) {
+			bool found = false;
+			std::vector<std::size_t> subset(size);
+			for (std::size_t i = 0; i < size; i++) subset[i] = i;
+			while (true) {
+				UPoly g(x, constant_one<C>::get());
+				UPoly h(x, constant_one<C>::get());
+				for (std::size_t i = 0, k = 0; i < images.size(); i++) {
+					if (k < size && subset[k] == i) {
+						g *= images[i];
+						k++;
+					} else {
+						h *= images[i];
+					}
+				}
+				Poly G, H;
+				if (MultivariateHensel<C,O,P>::lift(rest, x, point, g, h, G, H)) {
+					Poly factor = G.divideBy(content(G, x)).quotient;
+					res.push_back(normalize(factor));
+					rest = rest.divideBy(factor).quotient;
+					for (std::size_t k = size; k > 0; k--) images.erase(images.begin() + std::ptrdiff_t(subset[k-1]));
+					found = true;
+					break;
+				}
+				// Next subset in lexicographical order.
+				std::size_t k = size;
+				while (k > 0 && subset[k-1] == images.size() - size + k - 1) k--;
+				if (k == 0) break;
+				subset[k-1]++;
+				for (std::size_t j = k; j < size; j++) subset[j] = subset[j-1] + 1;
+			}
+			if (!found) size++;
+		}
+		res.push_back(normalize(rest));
+		return res;
+	}
+
+	/**
+	 * Adds the irreducible factors of a normalized polynomial with the given multiplicity to the factors.
+	 * The content with respect to some variable is factored recursively, the primitive part is decomposed
+	 * into square-free parts which are then factored.
+	 */
+	template<typename C, typename O, typename P>
+	void factor(const MultivariatePolynomial<C,O,P>& p, uint multiplicity, Factors<MultivariatePolynomial<C,O,P>>& factors, std::mt19937& rng) {
+		using Poly = MultivariatePolynomial<C,O,P>;
+		if (p.isConstant()) return;
+		// Use the variable with the smallest positive degree as main variable.
+		Variable x = Variable::NO_VARIABLE;
+		for (auto v: p.gatherVariables()) {
+			if (x == Variable::NO_VARIABLE || p.degree(v) < p.degree(x)) x = v;
+		}
+		Poly cont = content(p, x);
+		Poly f = p;
+		if (!cont.isConstant()) {
+			factor(cont, multiplicity, factors, rng);
+			f = f.divideBy(cont).quotient;
+		}
+		// Square-free decomposition with respect to x due to Yun.
+		Poly derivative = f.derivative(x);
+		Poly c = carl::gcd(f, derivative);
+		Poly w = f.divideBy(c).quotient;
+		Poly z = derivative.divideBy(c).quotient - w.derivative(x);
+		for (uint i = 1; !w.isConstant(); i++) {
+			Poly g = z.isZero() ? w : carl::gcd(w, z);
+			if (!g.isConstant()) {
+				for (const auto& q: irreducible(g, x, rng)) factors[q] += i * multiplicity;
+			}
+			w = w.divideBy(g).quotient;
+			z = z.divideBy(g).quotient - w.derivative(x);
+		}
+	}
+
+	/**
+	 * Computes the irreducible factors of a multivariate polynomial over the rationals.
+	 * The factors have coprime integral coefficients and positive leading coefficients, the remaining constant factor is added if it is not one.
+	 */
+	template<typename C, typename O, typename P>
+	Factors<MultivariatePolynomial<C,O,P>> factor(const MultivariatePolynomial<C,O,P>& p) {
+		using Poly = MultivariatePolynomial<C,O,P>;
+		static_assert(is_rational<C>::value, "The multivariate factorization is only implemented for rational coefficients.");
+		assert(!p.isZero());
+		Factors<Poly> res;
+		std::mt19937 rng(p.totalDegree());
+		factor(normalize(p), 1, res, rng);
+		C constant = p.lcoeff();
+		for (const auto& f: res) constant /= carl::pow(f.first.lcoeff(), f.second);
+		if (!isOne(constant)) res.emplace(Poly(constant), 1);
+		return res;
+	}
+}
+
+}
@@ -2,9 +2,42 @@
 
 #include "../logging.h"
 #include "../UnivariatePolynomial.h"
+#include "GCD.h"
+#include "ModularFactorization.h"
 
 namespace carl {
 
+namespace helper {
+	/**
+	 * Splits a square-free polynomial into its irreducible factors.
+	 * This is done by the modular factorization for rational coefficients, otherwise the polynomial is returned as is.
+	 */
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	std::vector<UnivariatePolynomial<Coeff>> splitSquareFree(const UnivariatePolynomial<Coeff>& p) {
+		if (p.degree() <= 1) return {p};
+		return modular_factorization::factor(p);
+	}
+	template<typename Coeff, DisableIf<is_rational<Coeff>> = dummy>
+	std::vector<UnivariatePolynomial<Coeff>> splitSquareFree(const UnivariatePolynomial<Coeff>& p) {
+		return {p};
+	}
+
+	/**
+	 * Computes the monic gcd of two polynomials as needed for the square-free factorization.
+	 * This is done by the modular gcd for rational coefficients, otherwise by the extended euclidean algorithm.
+	 */
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	UnivariatePolynomial<Coeff> squareFreeGCD(const UnivariatePolynomial<Coeff>& a, const UnivariatePolynomial<Coeff>& b) {
+		return modular_gcd::compute(a, b).normalized();
+	}
+	template<typename Coeff, DisableIf<is_rational<Coeff>> = dummy>
+	UnivariatePolynomial<Coeff> squareFreeGCD(const UnivariatePolynomial<Coeff>& a, const UnivariatePolynomial<Coeff>& b) {
+		UnivariatePolynomial<Coeff> s(a.mainVar());
+		UnivariatePolynomial<Coeff> t(a.mainVar());
+		return carl::extended_gcd(a, b, s, t);
+	}
+}
+
 template<typename Coeff>
 std::map<uint, UnivariatePolynomial<Coeff>> squareFreeFactorization(const UnivariatePolynomial<Coeff>& p) {
 	CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: " << p);
@@ -24,10 +57,8 @@ CLANG_WARNING_RESET
 		assert(!p.isConstant()); // Othewise, the derivative is zero and the next assertion is thrown.
 		UnivariatePolynomial<Coeff> b = p.derivative();
 		CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: b = " << b);
-		UnivariatePolynomial<Coeff> s(p.mainVar());
-		UnivariatePolynomial<Coeff> t(p.mainVar());
 		assert(!b.isZero());
-		UnivariatePolynomial<Coeff> c = carl::extended_gcd(p, b, s, t); // TODO: use gcd instead
+		UnivariatePolynomial<Coeff> c = helper::squareFreeGCD(p, b);
 		typename IntegralType<Coeff>::type numOfCpf = getNum(c.coprimeFactor());
 		if(numOfCpf != 1) // TODO: is this maybe only necessary because the extended_gcd returns a polynomial with non-integer coefficients but it shouldn't?
 		{
@@ -51,7 +82,7 @@ CLANG_WARNING_RESET
 			while(!z.isZero())
 			{
 				CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: next iteration");
-				UnivariatePolynomial<Coeff> g = carl::extended_gcd(w, z, s, t); // TODO: use gcd instead
+				UnivariatePolynomial<Coeff> g = helper::squareFreeGCD(w, z);
 				numOfCpf = getNum(g.coprimeFactor());
 				if(numOfCpf != 1) // TODO: is this maybe only necessary because the extended_gcd returns a polynomial with non-integer coefficients but it shouldn't?
 				{
@@ -108,13 +139,16 @@ FactorMap<Coeff> factorization(const UnivariatePolynomial<Coeff>& p) {
 	}
 	assert(p.coefficients().size() > 1);
 	// Exclude the factors  (x-r)^i  with  r rational.
-	remainingPoly = UnivariatePolynomial<Coeff>::excludeLinearFactors(remainingPoly, result, static_cast<carl::sint>(INT_MAX));
+	// For rational coefficients, the modular factorization finds these factors anyway, hence only the cheap candidates are checked.
+	carl::sint maxInt = is_rational<Coeff>::value ? 1 : static_cast<carl::sint>(INT_MAX);
+	remainingPoly = UnivariatePolynomial<Coeff>::excludeLinearFactors(remainingPoly, result, maxInt);
 	assert(!remainingPoly.isConstant() || remainingPoly.lcoeff() == (Coeff)1);
 	if(!remainingPoly.isConstant())
 	{
 		CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: Calculating square-free factorization of " << remainingPoly);
 		// Calculate the square free factorization.
 		auto sff = carl::squareFreeFactorization(remainingPoly);
+		Coeff constant = constant_one<Coeff>::get();
 //		factor = (Coeff) 1;
 		for(auto expFactorPair = sff.begin(); expFactorPair != sff.end(); ++expFactorPair)
 		{
@@ -126,13 +160,42 @@ FactorMap<Coeff> factorization(const UnivariatePolynomial<Coeff>& p) {
 //			}
 			if(!expFactorPair->second.isConstant() || !carl::isOne(expFactorPair->second.lcoeff()))
 			{
-				auto retVal = result.emplace(expFactorPair->second, expFactorPair->first);
-				CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << expFactorPair->second << ")^" << expFactorPair->first );
-				if(!retVal.second)
+				if(expFactorPair->second.isConstant())
 				{
-					retVal.first->second += expFactorPair->first;
+					auto retVal = result.emplace(expFactorPair->second, expFactorPair->first);
+					CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << expFactorPair->second << ")^" << expFactorPair->first );
+					if(!retVal.second)
+					{
+						retVal.first->second += expFactorPair->first;
+					}
+					continue;
 				}
+				// Split the square-free part further and collect the constant factor that is left over.
+				Coeff remainder = expFactorPair->second.lcoeff();
+				for(const auto& irreducible: helper::splitSquareFree(expFactorPair->second))
+				{
+					remainder /= irreducible.lcoeff();
+					auto retVal = result.emplace(irreducible, expFactorPair->first);
+					CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << irreducible << ")^" << expFactorPair->first );
+					if(!retVal.second)
+					{
+						retVal.first->second += expFactorPair->first;
+					}
+				}
+				constant *= carl::pow(remainder, expFactorPair->first);
+			}
+		}
+		if(!carl::isOne(constant))
+		{
+			// Merge the remaining constant with the constant factor.
+			auto it = std::find_if(result.begin(), result.end(), [](const auto& f){ return f.first.isConstant(); });
+			if(it != result.end() && it->second == 1)
+			{
+				constant *= it->first.lcoeff();
+				result.erase(it);
 			}
+			CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << constant << ")^" << 1 );
+			result.emplace(UnivariatePolynomial<Coeff>(p.mainVar(), constant), 1);
 		}
 //		if(factor != (Coeff) 1)
 //		{
@@ -1,10 +1,101 @@
+/**
+ * @file LazardEvaluation.h
+ *
+ * Implements the Lazard evaluation of a polynomial at a point, that is the leading coefficient of its Taylor expansion
+ * at the point with respect to the lexicographical order of the variables @cite Lazard94 .
+ * Other than the plain substitution, the Lazard evaluation is never identically zero, hence it allows to lift over
+ * sample points where a polynomial is nullified.
+ */
+
 #pragma once
 
-#include "../../formula/model/Model.h"
-#include "../../formula/model/evaluation/ModelEvaluation.h"
+#include "../../formula/model/ran/RealAlgebraicNumber.h"
+#include "../../formula/model/ran/RealAlgebraicNumberEvaluation.h"
+#include "../logging.h"
+#include "../MultivariatePolynomial.h"
+#include "../UnivariatePolynomial.h"
+
+#include <map>
+#include <vector>
+
+namespace carl {
+
+namespace lazard {
+
+	/**
+	 * Checks whether p vanishes identically if the given variables are substituted by their values in m.
+	 * The remaining variables of p are given in others, p is then considered as a polynomial in the remaining variables
+	 * and every coefficient is evaluated using the real algebraic numbers.
+	 */
+	template<typename Number>
+	bool vanishes(const MultivariatePolynomial<Number>& p, const std::vector<Variable>& others, std::size_t next, const std::map<Variable, RealAlgebraicNumber<Number>>& m) {
+		if (p.isZero()) return true;
+		while (next < others.size() && !p.has(others[next])) next++;
+		if (next == others.size()) {
+			std::map<Variable, RealAlgebraicNumber<Number>> values;
+			for (const auto& r: m) {
+				if (p.has(r.first)) values.emplace(r.first, r.second);
+			}
+			return RealAlgebraicNumberEvaluation::evaluateSign(p, values) == Sign::ZERO;
+		}
+		auto coeffs = p.toUnivariatePolynomial(others[next]);
+		for (const auto& c: coeffs.coefficients()) {
+			if (!vanishes(c, others, next + 1, m)) return false;
+		}
+		return true;
+	}
+
+	/// Computes the derivative of all coefficients with respect to v.
+	template<typename Coeff>
+	UnivariatePolynomial<Coeff> derivative(const UnivariatePolynomial<Coeff>& p, Variable v) {
+		std::vector<Coeff> coeffs;
+		for (const auto& c: p.coefficients()) coeffs.push_back(c.isZero() ? c : c.derivative(v));
+		return UnivariatePolynomial<Coeff>(p.mainVar(), coeffs);
+	}
+}
+
+/**
+ * Computes a polynomial whose roots over the given point are the roots of the Lazard evaluation of p.
+ * For every variable in the given order, p is differentiated with respect to this variable as long as it vanishes
+ * identically after substituting all variables up to this one.
+ * As the derivatives are the Taylor coefficients up to a constant factor, the result evaluated at the point is the
+ * Lazard evaluation of p up to a constant factor. It is never zero unless p is zero.
+ * @param p Polynomial, its main variable is not assigned.
+ * @param variables Assigned variables in the order of the lifting, the first one is assigned first.
+ * @param m Real algebraic numbers assigned to the variables.
+ * @return Polynomial with rational coefficients that does not vanish identically over the point.
+ */
+template<typename Number>
+UnivariatePolynomial<MultivariatePolynomial<Number>> lazardEvaluation(const UnivariatePolynomial<MultivariatePolynomial<Number>>& p, const std::vector<Variable>& variables, const std::map<Variable, RealAlgebraicNumber<Number>>& m) {
+	using UPoly = UnivariatePolynomial<MultivariatePolynomial<Number>>;
+	UPoly res = p;
+	if (res.isZero()) return res;
+	std::map<Variable, RealAlgebraicNumber<Number>> assigned;
+	for (std::size_t i = 0; i < variables.size(); i++) {
+		assigned.emplace(variables[i], m.at(variables[i]));
+		std::vector<Variable> others(variables.begin() + std::ptrdiff_t(i + 1), variables.end());
+		auto isNullified = [&](const UPoly& q){
+			for (const auto& c: q.coefficients()) {
+				if (!lazard::vanishes(c, others, 0, assigned)) return false;
+			}
+			return true;
+		};
+		while (isNullified(res)) {
+			CARL_LOG_DEBUG("carl.lazard", res << " vanishes on " << assigned << ", differentiating by " << variables[i]);
+			res = lazard::derivative(res, variables[i]);
+			assert(!res.isZero());
+		}
+	}
+	return res;
+}
+
+}
 
 #ifdef USE_COCOA
 
+#include "../../formula/model/Model.h"
+#include "../../formula/model/evaluation/ModelEvaluation.h"
+
 #include <CoCoA/library.H>
 
 namespace carl {
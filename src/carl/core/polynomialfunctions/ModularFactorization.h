@@ -0,0 +1,391 @@
+/**
+ * @file ModularFactorization.h
+ *
+ * Implements the factorization of univariate integral polynomials due to Zassenhaus @cite Zassenhaus69 .
+ * The polynomial is factored modulo a prime using distinct-degree and equal-degree factorization @cite CantorZassenhaus81 .
+ * The modular factors are lifted to a sufficiently large prime power by Hensel lifting, and the true factors are obtained by recombination.
+ */
+
+#pragma once
+
+#include "ModularGCD.h"
+
+#include <random>
+
+namespace carl {
+
+namespace modular_factorization {
+
+	using modular_gcd::Dense;
+	using modular_resultant::GF;
+	using modular_resultant::Prime;
+
+	/// Number of suitable primes that are tried, the one with the fewest modular factors is used.
+	static constexpr std::size_t CandidatePrimes = 3;
+
+	inline Dense add(Dense a, const Dense& b) {
+		if (a.size() < b.size()) a.resize(b.size(), GF(0, b.front().gf()));
+		for (std::size_t i = 0; i < b.size(); i++) a[i] = a[i] + b[i];
+		modular_gcd::trim(a);
+		return a;
+	}
+
+	inline Dense subtract(Dense a, const Dense& b) {
+		if (a.size() < b.size()) a.resize(b.size(), GF(0, b.front().gf()));
+		for (std::size_t i = 0; i < b.size(); i++) a[i] = a[i] - b[i];
+		modular_gcd::trim(a);
+		return a;
+	}
+
+	inline Dense remainder(Dense a, const Dense& m) {
+		modular_gcd::divide(a, m);
+		return a;
+	}
+
+	/// Computes base^exp modulo m.
+	inline Dense pow(const Dense& base, uint exp, const Dense& m) {
+		Dense res(1, GF(1, m.front().gf()));
+		Dense b = remainder(base, m);
+		for (; exp > 0; exp /= 2) {
+			if (exp % 2 == 1) res = remainder(modular_gcd::multiply(res, b), m);
+			b = remainder(modular_gcd::multiply(b, b), m);
+		}
+		return res;
+	}
+
+	/**
+	 * Computes s and t such that s*a + t*b = 1.
+	 * Assumes that a and b are coprime.
+	 */
+	inline void extendedGCD(const Dense& a, const Dense& b, Dense& s, Dense& t) {
+		const GaloisField<sint>* gf = a.front().gf();
+		Dense r0 = a, r1 = b;
+		Dense s0(1, GF(1, gf)), s1;
+		Dense t0, t1(1, GF(1, gf));
+		while (!r1.empty()) {
+			Dense q = modular_gcd::divide(r0, r1);
+			std::swap(r0, r1);
+			s0 = subtract(s0, modular_gcd::multiply(q, s1));
+			std::swap(s0, s1);
+			t0 = subtract(t0, modular_gcd::multiply(q, t1));
+			std::swap(t0, t1);
+		}
+		assert(r0.size() == 1);
+		GF inv = r0.front().inverse();
+		s = s0;
+		t = t0;
+		for (auto& c: s) c = c * inv;
+		for (auto& c: t) c = c * inv;
+	}
+
+	/**
+	 * Splits a monic, square-free polynomial into products of irreducible factors of equal degree.
+	 * @return Pairs of the products and the degree of their irreducible factors.
+	 */
+	inline std::vector<std::pair<Dense, std::size_t>> distinctDegree(Dense f) {
+		const GaloisField<sint>* gf = f.front().gf();
+		std::vector<std::pair<Dense, std::size_t>> res;
+		Dense x({GF(0, gf), GF(1, gf)});
+		Dense h = x;
+		for (std::size_t d = 1; 2 * d < f.size(); d++) {
+			// h = x^(p^d) mod f
+			h = pow(h, gf->p(), f);
+			Dense g = modular_gcd::gcd(f, subtract(h, x));
+			if (g.size() > 1) {
+				res.emplace_back(g, d);
+				f = modular_gcd::divide(f, g);
+				h = remainder(h, f);
+			}
+		}
+		if (f.size() > 1) res.emplace_back(f, f.size() - 1);
+		return res;
+	}
+
+	/**
+	 * Splits a monic product of irreducible factors of degree d into these factors.
+	 * Uses the probabilistic algorithm of Cantor and Zassenhaus, hence the prime is assumed to be odd.
+	 */
+	inline void equalDegree(const Dense& f, std::size_t d, std::mt19937& rng, std::vector<Dense>& res) {
+		if (f.size() - 1 == d) {
+			res.push_back(f);
+			return;
+		}
+		const GaloisField<sint>* gf = f.front().gf();
+		while (true) {
+			Dense a;
+			for (std::size_t i = 0; i + 1 < f.size(); i++) a.emplace_back(sint(rng() % gf->p()), gf);
+			modular_gcd::trim(a);
+			if (a.size() < 2) continue;
+			Dense g = modular_gcd::gcd(a, f);
+			if (g.size() == 1) {
+				// a^((p^d-1)/2) = (a * a^p * ... * a^(p^(d-1)))^((p-1)/2)
+				Dense b = a;
+				Dense norm = a;
+				for (std::size_t i = 1; i < d; i++) {
+					b = pow(b, gf->p(), f);
+					norm = remainder(modular_gcd::multiply(norm, b), f);
+				}
+				norm = pow(norm, (gf->p() - 1) / 2, f);
+				g = modular_gcd::gcd(subtract(norm, Dense(1, GF(1, gf))), f);
+			}
+			if (g.size() > 1 && g.size() < f.size()) {
+				Dense rest = f;
+				Dense quotient = modular_gcd::divide(rest, g);
+				equalDegree(g, d, rng, res);
+				equalDegree(quotient, d, rng, res);
+				return;
+			}
+		}
+	}
+
+	/// Computes the monic irreducible factors of a square-free polynomial modulo a prime.
+	inline std::vector<Dense> factor(const Dense& f, std::mt19937& rng) {
+		std::vector<Dense> res;
+		for (const auto& part: distinctDegree(modular_gcd::monic(f))) {
+			equalDegree(part.first, part.second, rng, res);
+		}
+		return res;
+	}
+
+	template<typename Integer>
+	Dense reduce(const std::vector<Integer>& f, const GaloisField<sint>* gf) {
+		Dense res;
+		Integer prime(gf->p());
+		for (const auto& c: f) res.emplace_back(toInt<sint>(Integer(carl::mod(c, prime))), gf);
+		modular_gcd::trim(res);
+		return res;
+	}
+
+	/// Converts a polynomial over a finite field to integral coefficients from the symmetric range.
+	template<typename Integer>
+	std::vector<Integer> lift(const Dense& f) {
+		std::vector<Integer> res;
+		for (const auto& c: f) res.emplace_back(modular_gcd::symmetric(c));
+		return res;
+	}
+
+	/// Reduces the coefficients modulo the given modulus. As carl::mod keeps the sign, the coefficients are from \f$(-m, m)\f$.
+	template<typename Integer>
+	void reduce(std::vector<Integer>& f, const Integer& modulus) {
+		for (auto& c: f) c = carl::mod(c, modulus);
+		while (!f.empty() && isZero(f.back())) f.pop_back();
+	}
+
+	template<typename Integer>
+	std::vector<Integer> multiply(const std::vector<Integer>& a, const std::vector<Integer>& b, const Integer& modulus) {
+		std::vector<Integer> res(a.size() + b.size() - 1, constant_zero<Integer>::get());
+		for (std::size_t i = 0; i < a.size(); i++) {
+			for (std::size_t j = 0; j < b.size(); j++) {
+				res[i+j] += a[i] * b[j];
+			}
+		}
+		reduce(res, modulus);
+		return res;
+	}
+
+	/**
+	 * Lifts the factorization \f$ f = g h \mod p \f$ to \f$ f = g h \mod p^k \f$, where modulus is \f$ p^k \f$.
+	 * Assumes that h is monic and that the leading coefficient of g is the one of f.
+	 * @param s,t Bezout coefficients of g and h modulo p.
+	 */
+	template<typename Integer>
+	void hensel(const std::vector<Integer>& f, std::vector<Integer>& g, std::vector<Integer>& h, const Dense& s, const Dense& t, const GaloisField<sint>* gf, const Integer& modulus) {
+		Integer prime(gf->p());
+		for (Integer power = prime; power < modulus; power *= prime) {
+			// e = (f - g h) / p^i
+			std::vector<Integer> e = f;
+			std::vector<Integer> gh = multiply(g, h, modulus);
+			if (e.size() < gh.size()) e.resize(gh.size(), constant_zero<Integer>::get());
+			for (std::size_t i = 0; i < gh.size(); i++) e[i] -= gh[i];
+			reduce(e, modulus);
+			for (auto& c: e) c = carl::div(c, power);
+			Dense ep = reduce(e, gf);
+			if (ep.empty()) continue;
+			// Solve sigma g + tau h = e with deg(sigma) < deg(h).
+			Dense se = modular_gcd::multiply(s, ep);
+			Dense quotient = modular_gcd::divide(se, reduce(h, gf));
+			Dense tau = add(modular_gcd::multiply(t, ep), modular_gcd::multiply(quotient, reduce(g, gf)));
+			std::vector<Integer> sigma = lift<Integer>(se);
+			std::vector<Integer> tauInt = lift<Integer>(tau);
+			assert(sigma.size() < h.size() && tauInt.size() < g.size());
+			for (std::size_t i = 0; i < tauInt.size(); i++) g[i] += power * tauInt[i];
+			for (std::size_t i = 0; i < sigma.size(); i++) h[i] += power * sigma[i];
+			reduce(g, modulus);
+			reduce(h, modulus);
+		}
+	}
+
+	/// Computes the inverse of a modulo modulus, given the inverse modulo the prime, using newton iteration.
+	template<typename Integer>
+	Integer inverse(const Integer& a, const GF& inv, const Integer& modulus) {
+		Integer res(modular_gcd::symmetric(inv));
+		Integer prime(inv.gf()->p());
+		for (Integer power = prime; power < modulus; power *= power) {
+			res = carl::mod(Integer(res * (Integer(2) - a * res)), modulus);
+		}
+		return res;
+	}
+
+	template<typename Integer>
+	std::vector<Integer> symmetric(std::vector<Integer> f, const Integer& modulus) {
+		Integer half = carl::quotient(modulus, Integer(2));
+		for (auto& c: f) {
+			c = carl::mod(c, modulus);
+			if (c > half) c -= modulus;
+			else if (c < -half) c += modulus;
+		}
+		return f;
+	}
+
+	template<typename Integer>
+	Integer norm1(const std::vector<Integer>& f) {
+		Integer res = constant_zero<Integer>::get();
+		for (const auto& c: f) res += carl::abs(c);
+		return res;
+	}
+
+	/// Makes f primitive with a positive leading coefficient.
+	template<typename Integer>
+	std::vector<Integer> primitive(std::vector<Integer> f) {
+		Integer content = constant_zero<Integer>::get();
+		for (const auto& c: f) content = carl::gcd(content, c);
+		if (isNegative(f.back())) content = -content;
+		for (auto& c: f) c = carl::div(c, content);
+		return f;
+	}
+
+	/**
+	 * Computes the irreducible factors of an integral polynomial.
+	 * The polynomial is given as dense coefficient vector and is assumed to be primitive and square-free with a positive leading coefficient.
+	 * The factors are primitive with positive leading coefficients.
+	 */
+	template<typename Integer>
+	std::vector<std::vector<Integer>> factor(const std::vector<Integer>& f) {
+		std::size_t n = f.size() - 1;
+		if (n <= 1) return {f};
+		std::mt19937 rng(n);
+		// Choose a prime such that f stays square-free with the same degree and has few modular factors.
+		const GaloisField<sint>* gf = nullptr;
+		std::vector<Dense> modular;
+		std::size_t candidates = 0;
+		PrimeFactory<mpz_class> primes;
+		while (candidates < CandidatePrimes) {
+			Prime prime = modular_resultant::nextPrime(primes);
+			const GaloisField<sint>* field = GaloisFieldManager<sint>::getInstance().getField(prime);
+			Dense fp = reduce(f, field);
+			if (fp.size() != f.size()) continue;
+			Dense derivative;
+			for (std::size_t i = 1; i < fp.size(); i++) derivative.push_back(fp[i] * GF(sint(i), field));
+			modular_gcd::trim(derivative);
+			if (modular_gcd::gcd(fp, derivative).size() > 1) continue;
+			candidates++;
+			std::vector<Dense> factors = factor(fp, rng);
+			CARL_LOG_DEBUG("carl.core.factorize", "Found " << factors.size() << " factors modulo " << prime);
+			if (gf == nullptr || factors.size() < modular.size()) {
+				gf = field;
+				modular = std::move(factors);
+			}
+			if (modular.size() == 1) return {f};
+		}
+
+		// Lift to a modulus exceeding twice the coefficient bound 2^n * (n+1) * |f|_inf * lc(f).
+		Integer maxCoeff = constant_zero<Integer>::get();
+		for (const auto& c: f) maxCoeff = std::max(maxCoeff, Integer(carl::abs(c)));
+		Integer bound = carl::pow(Integer(2), n) * Integer(n + 1) * maxCoeff * f.back();
+		Integer prime(gf->p());
+		Integer modulus = prime;
+		while (modulus <= Integer(2) * bound) modulus *= prime;
+
+		// Lift f = lc(f) * u_1 * ... * u_r factor by factor.
+		std::vector<std::vector<Integer>> lifted;
+		std::vector<Integer> target = f;
+		for (std::size_t i = 0; i + 1 < modular.size(); i++) {
+			GF lc = reduce(std::vector<Integer>({target.back()}), gf).front();
+			Dense g = modular[i];
+			for (auto& c: g) c = c * lc;
+			Dense h(1, GF(1, gf));
+			for (std::size_t j = i + 1; j < modular.size(); j++) h = modular_gcd::multiply(h, modular[j]);
+			Dense s, t;
+			extendedGCD(g, h, s, t);
+			std::vector<Integer> gi = lift<Integer>(g);
+			std::vector<Integer> hi = lift<Integer>(h);
+			gi.back() = target.back();
+			hensel(target, gi, hi, s, t, gf, modulus);
+			// Make the lifted factor monic.
+			Integer inv = inverse(target.back(), lc.inverse(), modulus);
+			for (auto& c: gi) c = carl::mod(Integer(c * inv), modulus);
+			lifted.push_back(std::move(gi));
+			target = std::move(hi);
+		}
+		lifted.push_back(std::move(target));
+
+		// Combine the lifted factors to the true factors.
+		std::vector<std::vector<Integer>> res;
+		std::vector<Integer> rest = f;
+		std::size_t size = 1;
+		while (2 * size <= lifted.size()) {
+			bool found = false;
+			std::vector<std::size_t> subset(size);
+			for (std::size_t i = 0; i < size; i++) subset[i] = i;
+			while (true) {
+				std::vector<Integer> g(1, rest.back());
+				std::vector<Integer> h(1, rest.back());
+				for (std::size_t i = 0, k = 0; i < lifted.size(); i++) {
+					if (k < size && subset[k] == i) {
+						g = multiply(g, lifted[i], modulus);
+						k++;
+					} else {
+						h = multiply(h, lifted[i], modulus);
+					}
+				}
+				g = symmetric(g, modulus);
+				h = symmetric(h, modulus);
+				if (norm1(g) * norm1(h) <= bound) {
+					res.push_back(primitive(g));
+					rest = primitive(h);
+					for (std::size_t k = size; k > 0; k--) lifted.erase(lifted.begin() + std::ptrdiff_t(subset[k-1]));
+					found = true;
+					break;
+				}
+				// Next subset in lexicographical order.
+				std::size_t k = size;
+				while (k > 0 && subset[k-1] == lifted.size() - size + k - 1) k--;
+				if (k == 0) break;
+				subset[k-1]++;
+				for (std::size_t j = k; j < size; j++) subset[j] = subset[j-1] + 1;
+			}
+			if (!found) size++;
+		}
+		res.push_back(std::move(rest));
+		return res;
+	}
+
+	/**
+	 * Computes the irreducible factors of a square-free univariate polynomial over the rationals.
+	 * The factors have coprime integral coefficients and positive leading coefficients.
+	 */
+	template<typename Coeff>
+	std::vector<UnivariatePolynomial<Coeff>> factor(const UnivariatePolynomial<Coeff>& p) {
+		using Integer = typename IntegralType<Coeff>::type;
+		static_assert(is_rational<Coeff>::value, "The modular factorization is only implemented for rational coefficients.");
+		assert(!p.isConstant());
+		Integer num = constant_zero<Integer>::get();
+		Integer den = constant_one<Integer>::get();
+		for (const auto& c: p.coefficients()) {
+			num = carl::gcd(num, getNum(c));
+			den = carl::lcm(den, getDenom(c));
+		}
+		Coeff factor = Coeff(den) / Coeff(num);
+		if (isNegative(p.lcoeff())) factor = -factor;
+		std::vector<Integer> f;
+		for (const auto& c: p.coefficients()) f.push_back(getNum(Coeff(c * factor)));
+		std::vector<UnivariatePolynomial<Coeff>> res;
+		for (const auto& g: modular_factorization::factor(f)) {
+			std::vector<Coeff> coeffs(g.begin(), g.end());
+			res.emplace_back(p.mainVar(), std::move(coeffs));
+		}
+		return res;
+	}
+}
+
+}
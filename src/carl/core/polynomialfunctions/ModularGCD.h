@@ -0,0 +1,475 @@
+/**
+ * @file ModularGCD.h
+ *
+ * Implements the dense modular gcd algorithm for multivariate polynomials due to Brown @cite Brown71 .
+ * The gcd is computed modulo several primes, where the variables are eliminated recursively by evaluation and interpolation.
+ * The images are combined using the chinese remainder theorem and the result is verified by trial division.
+ */
+
+#pragma once
+
+#include "ModularResultant.h"
+
+#include <map>
+
+namespace carl {
+namespace modular_gcd {
+
+	using modular_resultant::Exponents;
+	using modular_resultant::Terms;
+	using modular_resultant::GF;
+	using modular_resultant::Prime;
+
+	/// A univariate polynomial over a finite field, indexed by the degree. The zero polynomial is empty.
+	using Dense = std::vector<GF>;
+	/// A polynomial over a finite field, grouped by the exponents of all but one variable.
+	using Grouped = std::map<Exponents, Dense>;
+
+	inline void trim(Dense& a) {
+		while (!a.empty() && a.back().isZero()) a.pop_back();
+	}
+
+	inline GF evaluate(const Dense& a, const GF& value) {
+		GF res(0, value.gf());
+		for (auto it = a.rbegin(); it != a.rend(); it++) res = res * value + *it;
+		return res;
+	}
+
+	inline Dense multiply(const Dense& a, const Dense& b) {
+		if (a.empty() || b.empty()) return Dense();
+		Dense res(a.size() + b.size() - 1, GF(0, a.front().gf()));
+		for (std::size_t i = 0; i < a.size(); i++) {
+			for (std::size_t j = 0; j < b.size(); j++) {
+				res[i+j] = res[i+j] + a[i] * b[j];
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Divides a by b and returns the quotient.
+	 * The division is done in place, hence a holds the remainder afterwards.
+	 */
+	inline Dense divide(Dense& a, const Dense& b) {
+		assert(!b.empty());
+		if (a.size() < b.size()) return Dense();
+		GF lcInv = b.back().inverse();
+		Dense q(a.size() - b.size() + 1, GF(0, b.front().gf()));
+		for (std::size_t i = a.size(); i >= b.size(); i--) {
+			GF factor = a[i-1] * lcInv;
+			if (factor.isZero()) continue;
+			q[i - b.size()] = factor;
+			for (std::size_t k = 0; k < b.size(); k++) {
+				a[i - b.size() + k] = a[i - b.size() + k] - factor * b[k];
+			}
+		}
+		a.resize(b.size() - 1);
+		trim(a);
+		return q;
+	}
+
+	inline Dense monic(Dense a) {
+		if (a.empty()) return a;
+		GF inv = a.back().inverse();
+		for (auto& c: a) c = c * inv;
+		return a;
+	}
+
+	/// Computes the monic gcd of two univariate polynomials with the euclidean algorithm.
+	inline Dense gcd(Dense a, Dense b) {
+		while (!b.empty()) {
+			divide(a, b);
+			std::swap(a, b);
+		}
+		return monic(std::move(a));
+	}
+
+	/// Sorts the terms in ascending lexicographical order, merges equal monomials and removes zero terms.
+	inline void normalize(Terms<GF>& p) {
+		std::sort(p.begin(), p.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+		Terms<GF> res;
+		for (auto& t: p) {
+			if (!res.empty() && res.back().first == t.first) {
+				res.back().second = res.back().second + t.second;
+				if (res.back().second.isZero()) res.pop_back();
+			} else if (!t.second.isZero()) {
+				res.emplace_back(std::move(t));
+			}
+		}
+		p = std::move(res);
+	}
+
+	inline bool isConstant(const Terms<GF>& p) {
+		return std::all_of(p.back().first.begin(), p.back().first.end(), [](uint e){ return e == 0; });
+	}
+
+	/// Substitutes the given value for the given variable.
+	inline Terms<GF> specialize(const Terms<GF>& p, std::size_t var, const GF& value) {
+		Terms<GF> res;
+		Dense powers(1, GF(1, value.gf()));
+		for (const auto& t: p) {
+			while (powers.size() <= t.first[var]) powers.push_back(powers.back() * value);
+			res.emplace_back(t.first, t.second * powers[t.first[var]]);
+			res.back().first[var] = 0;
+		}
+		normalize(res);
+		return res;
+	}
+
+	/// Groups the terms by the remaining exponents, such that every group is a univariate polynomial in the given variable.
+	inline Grouped group(const Terms<GF>& p, std::size_t var) {
+		Grouped res;
+		for (const auto& t: p) {
+			Exponents e = t.first;
+			e[var] = 0;
+			Dense& c = res[e];
+			if (c.size() <= t.first[var]) c.resize(t.first[var] + 1, GF(0, t.second.gf()));
+			c[t.first[var]] = t.second;
+		}
+		return res;
+	}
+
+	inline Terms<GF> ungroup(const Grouped& p, std::size_t var) {
+		Terms<GF> res;
+		for (const auto& c: p) {
+			for (std::size_t i = 0; i < c.second.size(); i++) {
+				if (c.second[i].isZero()) continue;
+				res.emplace_back(c.first, c.second[i]);
+				res.back().first[var] = uint(i);
+			}
+		}
+		normalize(res);
+		return res;
+	}
+
+	/// Computes the content with respect to all but the given variable, that is a univariate polynomial in this variable.
+	inline Dense content(const Grouped& p) {
+		Dense res;
+		for (const auto& c: p) {
+			res = gcd(std::move(res), c.second);
+			if (res.size() == 1) break;
+		}
+		return res;
+	}
+
+	inline void divideContent(Grouped& p, const Dense& content) {
+		for (auto& c: p) {
+			Dense r = std::move(c.second);
+			c.second = divide(r, content);
+			assert(r.empty());
+		}
+	}
+
+	inline Terms<GF> monic(Terms<GF> p) {
+		GF inv = p.back().second.inverse();
+		for (auto& t: p) t.second = t.second * inv;
+		return p;
+	}
+
+	/// Checks whether divisor divides dividend, using the lexicographical order.
+	inline bool divides(const Terms<GF>& divisor, const Terms<GF>& dividend) {
+		std::map<Exponents, GF> remainder;
+		for (const auto& t: dividend) remainder.emplace(t.first, t.second);
+		const auto& lt = divisor.back();
+		GF lcInv = lt.second.inverse();
+		while (!remainder.empty()) {
+			auto r = std::prev(remainder.end());
+			Exponents shift(lt.first.size());
+			for (std::size_t i = 0; i < shift.size(); i++) {
+				if (r->first[i] < lt.first[i]) return false;
+				shift[i] = r->first[i] - lt.first[i];
+			}
+			GF factor = r->second * lcInv;
+			for (const auto& t: divisor) {
+				Exponents e = t.first;
+				for (std::size_t i = 0; i < e.size(); i++) e[i] += shift[i];
+				auto it = remainder.emplace(std::move(e), GF(0, factor.gf())).first;
+				it->second = it->second - factor * t.second;
+				if (it->second.isZero()) remainder.erase(it);
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Computes the monic gcd of a and b in the first vars variables modulo a prime.
+	 * The variable vars-1 is eliminated by evaluation and newton interpolation.
+	 * @return false, if the field is too small to provide enough evaluation points.
+	 */
+	inline bool compute(const Terms<GF>& a, const Terms<GF>& b, std::size_t vars, Terms<GF>& res) {
+		assert(!a.empty() && !b.empty());
+		const GaloisField<sint>* gf = a.front().second.gf();
+		if (vars == 0) {
+			res.assign(1, std::make_pair(Exponents(a.front().first.size(), 0), GF(1, gf)));
+			return true;
+		}
+		std::size_t var = vars - 1;
+		auto occurs = [var](const auto& t){ return t.first[var] > 0; };
+		if (std::none_of(a.begin(), a.end(), occurs) && std::none_of(b.begin(), b.end(), occurs)) {
+			return compute(a, b, var, res);
+		}
+		// Separate the contents, that are univariate polynomials in var.
+		Grouped ga = group(a, var);
+		Grouped gb = group(b, var);
+		Dense ca = content(ga);
+		Dense cb = content(gb);
+		Dense c = gcd(ca, cb);
+		divideContent(ga, ca);
+		divideContent(gb, cb);
+		// The leading coefficient of the gcd divides g.
+		const Dense& lca = ga.rbegin()->second;
+		const Dense& lcb = gb.rbegin()->second;
+		Dense g = gcd(lca, lcb);
+		std::size_t degA = 0;
+		std::size_t degB = 0;
+		for (const auto& t: ga) degA = std::max(degA, t.second.size() - 1);
+		for (const auto& t: gb) degB = std::max(degB, t.second.size() - 1);
+		std::size_t bound = std::min(degA, degB) + g.size() - 1;
+		Terms<GF> pa = ungroup(ga, var);
+		Terms<GF> pb = ungroup(gb, var);
+
+		Grouped interpolant;
+		Exponents lm;
+		Dense q;
+		std::size_t points = 0;
+		for (sint t = 0; ; t++) {
+			if (uint(t) >= gf->p()) return false;
+			GF point(t, gf);
+			if (evaluate(lca, point).isZero() || evaluate(lcb, point).isZero()) continue;
+			Terms<GF> image;
+			if (!compute(specialize(pa, var, point), specialize(pb, var, point), var, image)) return false;
+			if (isConstant(image)) {
+				// The primitive parts are coprime.
+				res = ungroup(Grouped({{image.back().first, c}}), var);
+				return true;
+			}
+			GF scale = evaluate(g, point);
+			for (auto& i: image) i.second = i.second * scale;
+			Dense linear({-point, GF(1, gf)});
+			if (points == 0 || image.back().first < lm) {
+				// All previous points were unlucky.
+				interpolant.clear();
+				for (const auto& i: image) interpolant.emplace(i.first, Dense(1, i.second));
+				lm = image.back().first;
+				q = linear;
+				points = 1;
+			} else if (lm < image.back().first) {
+				// This point is unlucky.
+				continue;
+			} else {
+				// Newton interpolation: interpolant += (image - interpolant(point)) / q(point) * q
+				GF inv = evaluate(q, point).inverse();
+				std::map<Exponents, GF> values(image.begin(), image.end());
+				for (const auto& i: image) interpolant.emplace(i.first, Dense());
+				for (auto& i: interpolant) {
+					auto it = values.find(i.first);
+					GF diff = (it == values.end() ? GF(0, gf) : it->second) - evaluate(i.second, point);
+					if (diff.isZero()) continue;
+					diff = diff * inv;
+					if (i.second.size() < q.size()) i.second.resize(q.size(), GF(0, gf));
+					for (std::size_t k = 0; k < q.size(); k++) i.second[k] = i.second[k] + diff * q[k];
+					trim(i.second);
+				}
+				q = multiply(q, linear);
+				points++;
+			}
+			if (points <= bound) continue;
+			Grouped candidate = interpolant;
+			divideContent(candidate, content(candidate));
+			Terms<GF> h = ungroup(candidate, var);
+			if (!divides(h, pa) || !divides(h, pb)) continue;
+			// Multiply with the gcd of the contents.
+			Terms<GF> product;
+			for (const auto& t: h) {
+				for (std::size_t i = 0; i < c.size(); i++) {
+					if (c[i].isZero()) continue;
+					product.emplace_back(t.first, t.second * c[i]);
+					product.back().first[var] += uint(i);
+				}
+			}
+			normalize(product);
+			res = monic(std::move(product));
+			return true;
+		}
+	}
+
+	/// Returns the representative of n from \f$[-(p-1)/2, (p-1)/2]\f$.
+	inline sint symmetric(const GF& n) {
+		sint prime = sint(n.gf()->p());
+		sint res = n.representingInteger() % prime;
+		if (res > prime / 2) res -= prime;
+		else if (res < -(prime / 2)) res += prime;
+		return res;
+	}
+
+	template<typename Integer>
+	Terms<GF> reduce(const Terms<Integer>& p, const GaloisField<sint>* gf) {
+		Terms<GF> res;
+		Integer prime(gf->p());
+		for (const auto& t: p) {
+			GF coeff(toInt<sint>(Integer(carl::mod(t.second, prime))), gf);
+			if (!coeff.isZero()) res.emplace_back(t.first, coeff);
+		}
+		return res;
+	}
+
+	/// Converts the terms to integral, primitive terms in ascending lexicographical order.
+	template<typename C>
+	Terms<typename IntegralType<C>::type> integral(Terms<C>&& terms) {
+		using Integer = typename IntegralType<C>::type;
+		Integer num = constant_zero<Integer>::get();
+		Integer den = constant_one<Integer>::get();
+		for (const auto& t: terms) {
+			num = carl::gcd(num, getNum(t.second));
+			den = carl::lcm(den, getDenom(t.second));
+		}
+		C factor = C(den) / C(num);
+		Terms<Integer> res;
+		for (auto& t: terms) {
+			res.emplace_back(std::move(t.first), getNum(C(t.second * factor)));
+		}
+		std::sort(res.begin(), res.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+		return res;
+	}
+
+	/**
+	 * Computes the gcd of two integral polynomials in the given number of variables.
+	 * As the result is only verified modulo some primes, the given predicate checks whether a candidate divides both inputs.
+	 * @return The primitive gcd, or an empty list of terms if the gcd is constant.
+	 */
+	template<typename Integer, typename Divides>
+	Terms<Integer> compute(const Terms<Integer>& A, const Terms<Integer>& B, std::size_t vars, Divides&& divides) {
+		// The leading coefficient of the gcd divides gamma, hence the scaled images have integral preimages.
+		Integer gamma = carl::gcd(A.back().second, B.back().second);
+
+		Terms<Integer> result;
+		Exponents lm;
+		Integer modulus = constant_one<Integer>::get();
+		PrimeFactory<mpz_class> primes;
+		while (true) {
+			Prime prime = modular_resultant::nextPrime(primes);
+			const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+			Terms<GF> Ap = reduce(A, gf);
+			Terms<GF> Bp = reduce(B, gf);
+			if (Ap.empty() || Bp.empty() || Ap.back().first != A.back().first || Bp.back().first != B.back().first) {
+				CARL_LOG_DEBUG("carl.core.gcd", "Skipping prime " << prime << " as it divides the leading coefficient.");
+				continue;
+			}
+			Terms<GF> image;
+			if (!compute(Ap, Bp, vars, image)) {
+				CARL_LOG_DEBUG("carl.core.gcd", "Skipping prime " << prime << " as there are not enough evaluation points.");
+				continue;
+			}
+			if (isConstant(image)) return Terms<Integer>();
+			GF scale(toInt<sint>(Integer(carl::mod(gamma, Integer(prime)))), gf);
+			for (auto& i: image) i.second = i.second * scale;
+			if (result.empty() || image.back().first < lm) {
+				result.clear();
+				for (const auto& i: image) result.emplace_back(i.first, Integer(symmetric(i.second)));
+				lm = image.back().first;
+				modulus = Integer(prime);
+				continue;
+			}
+			if (lm < image.back().first) {
+				CARL_LOG_DEBUG("carl.core.gcd", "Skipping unlucky prime " << prime);
+				continue;
+			}
+			// Combine with the previous result such that all coefficients stay within the symmetric range.
+			GF inverse = GF(toInt<sint>(Integer(carl::mod(modulus, Integer(prime)))), gf).inverse();
+			bool changed = false;
+			Terms<Integer> combined;
+			auto r = result.begin();
+			auto i = image.begin();
+			while (r != result.end() || i != image.end()) {
+				bool useR = r != result.end() && (i == image.end() || !(i->first < r->first));
+				bool useI = i != image.end() && (r == result.end() || !(r->first < i->first));
+				Exponents e = useR ? r->first : i->first;
+				Integer old = useR ? r->second : constant_zero<Integer>::get();
+				GF value = useI ? i->second : GF(0, gf);
+				if (useR) r++;
+				if (useI) i++;
+				GF digit = (value - GF(toInt<sint>(Integer(carl::mod(old, Integer(prime)))), gf)) * inverse;
+				if (!digit.isZero()) {
+					old += modulus * Integer(symmetric(digit));
+					changed = true;
+				}
+				if (!isZero(old)) combined.emplace_back(std::move(e), std::move(old));
+			}
+			result = std::move(combined);
+			modulus *= Integer(prime);
+			if (changed) continue;
+			// The result is stable, check whether it actually divides both inputs.
+			Integer content = constant_zero<Integer>::get();
+			for (const auto& t: result) content = carl::gcd(content, t.second);
+			Terms<Integer> candidate;
+			for (const auto& t: result) candidate.emplace_back(t.first, carl::div(t.second, content));
+			if (divides(candidate)) return candidate;
+			CARL_LOG_DEBUG("carl.core.gcd", "Candidate does not divide the inputs, continuing with more primes.");
+		}
+	}
+
+	/**
+	 * Computes the gcd of a and b using the modular algorithm.
+	 * As for the other gcd implementations, the result has coprime integral coefficients and a positive leading coefficient.
+	 */
+	template<typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> compute(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+		using Poly = MultivariatePolynomial<C,O,P>;
+		using Integer = typename IntegralType<C>::type;
+		static_assert(is_rational<C>::value, "The modular gcd is only implemented for rational coefficients.");
+		assert(!a.isZero() && !b.isZero());
+		std::set<Variable> varset;
+		a.gatherVariables(varset);
+		b.gatherVariables(varset);
+		std::vector<Variable> vars(varset.begin(), varset.end());
+		auto convert = [&vars](const Terms<Integer>& terms) {
+			Terms<C> res;
+			for (const auto& t: terms) res.emplace_back(t.first, C(t.second));
+			return modular_resultant::fromTerms<Poly>(std::move(res), vars);
+		};
+		Terms<Integer> res = compute(integral(modular_resultant::toTerms(a, vars)), integral(modular_resultant::toTerms(b, vars)), vars.size(),
+			[&](const Terms<Integer>& candidate){
+				Poly c = convert(candidate);
+				Poly quotient;
+				return a.divideBy(c, quotient) && b.divideBy(c, quotient);
+			}
+		);
+		if (res.empty()) return Poly(1);
+		return convert(res).coprimeCoefficients();
+	}
+
+	/**
+	 * Computes the gcd of two univariate polynomials over the rationals using the modular algorithm.
+	 * The result has coprime integral coefficients and a positive leading coefficient.
+	 */
+	template<typename C>
+	UnivariatePolynomial<C> compute(const UnivariatePolynomial<C>& a, const UnivariatePolynomial<C>& b) {
+		using Integer = typename IntegralType<C>::type;
+		static_assert(is_rational<C>::value, "The modular gcd is only implemented for rational coefficients.");
+		assert(!a.isZero() && !b.isZero());
+		auto toTerms = [](const UnivariatePolynomial<C>& p) {
+			Terms<C> res;
+			for (std::size_t i = 0; i < p.coefficients().size(); i++) {
+				if (!isZero(p.coefficients()[i])) res.emplace_back(Exponents(1, uint(i)), p.coefficients()[i]);
+			}
+			return res;
+		};
+		auto convert = [&a](const Terms<Integer>& terms) {
+			std::vector<C> coeffs(terms.back().first.front() + 1, constant_zero<C>::get());
+			for (const auto& t: terms) coeffs[t.first.front()] = C(t.second);
+			return UnivariatePolynomial<C>(a.mainVar(), std::move(coeffs));
+		};
+		Terms<Integer> res = compute(integral(toTerms(a)), integral(toTerms(b)), 1,
+			[&](const Terms<Integer>& candidate){
+				UnivariatePolynomial<C> c = convert(candidate);
+				return a.divideBy(c).remainder.isZero() && b.divideBy(c).remainder.isZero();
+			}
+		);
+		if (res.empty()) return UnivariatePolynomial<C>(a.mainVar(), constant_one<C>::get());
+		UnivariatePolynomial<C> result = convert(res);
+		if (isNegative(result.lcoeff())) return -result;
+		return result;
+	}
+}
+
+}
@@ -0,0 +1,419 @@
+/**
+ * @file ModularResultant.h
+ *
+ * Implements the modular resultant algorithm due to Collins @cite Collins71 .
+ * The resultant is computed modulo several primes, where the remaining variables are eliminated by evaluation and interpolation.
+ * The images are combined using the chinese remainder theorem.
+ */
+
+#pragma once
+
+#include "../logging.h"
+#include "../../numbers/GFNumber.h"
+#include "../../numbers/PrimeFactory.h"
+#include "../../util/SFINAE.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+template<typename Coeff>
+class UnivariatePolynomial;
+
+namespace modular_resultant {
+
+	/// The type of the primes, as used to identify the galois fields.
+	using Prime = GaloisField<sint>::BaseIntType;
+	/// Primes below this bound are skipped, as small fields provide only few evaluation points.
+	static constexpr Prime MinimalPrime = 1u << 15;
+	/// Number of additional primes that must confirm the reconstructed resultant before we terminate early.
+	static constexpr std::size_t ConfirmingPrimes = 2;
+
+	/**
+	 * Returns the next prime of the factory that is at least MinimalPrime.
+	 * Asserts that the prime still fits into Prime, which holds for any practical number of primes.
+	 */
+	inline Prime nextPrime(PrimeFactory<mpz_class>& primes) {
+		mpz_class prime;
+		do {
+			prime = primes.nextPrime();
+		} while (prime < MinimalPrime);
+		assert(prime <= std::numeric_limits<Prime>::max());
+		return static_cast<Prime>(toInt<uint>(prime));
+	}
+
+	/**
+	 * States if the modular algorithm is applicable for polynomials with the given coefficient type.
+	 * This is the case for multivariate polynomials over rational numbers.
+	 */
+	template<typename Coeff>
+	struct is_applicable: std::false_type {};
+	template<typename C, typename O, typename P>
+	struct is_applicable<MultivariatePolynomial<C,O,P>>: std::integral_constant<bool, is_rational<C>::value> {};
+
+	/// Exponents of the variables occurring in the coefficients.
+	using Exponents = std::vector<uint>;
+	/// A coefficient as a list of terms.
+	template<typename Number>
+	using Terms = std::vector<std::pair<Exponents, Number>>;
+	/// A polynomial in the main variable, indexed by the degree.
+	template<typename Number>
+	using Coefficients = std::vector<Terms<Number>>;
+
+	using GF = GFNumber<sint>;
+
+	template<typename Number>
+	struct Input {
+		/// Variables occurring in the coefficients.
+		std::vector<Variable> variables;
+		/// Integral, primitive coefficients.
+		std::vector<Coefficients<typename IntegralType<Number>::type>> polys;
+		/// Factors that were applied to obtain integral coefficients.
+		std::vector<Number> factors;
+	};
+
+	template<typename C, typename O, typename P>
+	Terms<C> toTerms(const MultivariatePolynomial<C,O,P>& c, const std::vector<Variable>& vars) {
+		Terms<C> res;
+		for (const auto& t: c) {
+			Exponents e(vars.size(), 0);
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					e[std::size_t(std::lower_bound(vars.begin(), vars.end(), ve.first) - vars.begin())] = ve.second;
+				}
+			}
+			res.emplace_back(std::move(e), t.coeff());
+		}
+		return res;
+	}
+
+	template<typename Coeff>
+	Coeff fromTerms(Terms<typename Coeff::CoeffType>&& terms, const std::vector<Variable>& vars) {
+		typename Coeff::TermsType res;
+		for (auto& t: terms) {
+			std::vector<std::pair<Variable, exponent>> m;
+			for (std::size_t i = 0; i < vars.size(); i++) {
+				if (t.first[i] > 0) m.emplace_back(vars[i], t.first[i]);
+			}
+			if (m.empty()) res.emplace_back(std::move(t.second));
+			else res.emplace_back(std::move(t.second), createMonomial(std::move(m)));
+		}
+		return Coeff(std::move(res), false, false);
+	}
+
+	/**
+	 * Converts the given polynomials to integral, primitive polynomials over a common set of variables.
+	 */
+	template<typename Coeff, typename Number>
+	Input<Number> prepare(const std::vector<const UnivariatePolynomial<Coeff>*>& polys) {
+		using Integer = typename IntegralType<Number>::type;
+		Input<Number> res;
+		std::set<Variable> vars;
+		for (const auto& p: polys) {
+			for (const auto& c: p->coefficients()) c.gatherVariables(vars);
+		}
+		res.variables.assign(vars.begin(), vars.end());
+		for (const auto& p: polys) {
+			std::vector<Terms<Number>> coeffs;
+			Integer num = constant_zero<Integer>::get();
+			Integer den = constant_one<Integer>::get();
+			for (const auto& c: p->coefficients()) {
+				coeffs.emplace_back(toTerms(c, res.variables));
+				for (const auto& t: coeffs.back()) {
+					num = carl::gcd(num, getNum(t.second));
+					den = carl::lcm(den, getDenom(t.second));
+				}
+			}
+			Number factor = Number(den) / Number(num);
+			Coefficients<Integer> poly;
+			for (auto& c: coeffs) {
+				poly.emplace_back();
+				for (auto& t: c) {
+					poly.back().emplace_back(std::move(t.first), getNum(Number(t.second * factor)));
+				}
+			}
+			res.polys.emplace_back(std::move(poly));
+			res.factors.emplace_back(factor);
+		}
+		return res;
+	}
+
+	inline GF pow(const GF& base, std::size_t exp) {
+		GF res(1, base.gf());
+		GF b = base;
+		for (; exp > 0; exp /= 2) {
+			if (exp % 2 == 1) res = res * b;
+			b = b * b;
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the resultant of two univariate polynomials over a finite field with the euclidean algorithm.
+	 * Both polynomials are given as dense coefficient vectors with nonzero leading coefficients.
+	 */
+	inline GF resultant(std::vector<GF> a, std::vector<GF> b, const GaloisField<sint>* gf) {
+		GF res(1, gf);
+		while (true) {
+			std::size_t m = a.size() - 1;
+			std::size_t n = b.size() - 1;
+			if (n == 0) return res * pow(b.front(), m);
+			// Reduce a modulo b. The reduction is done in place, hence a holds the remainder afterwards.
+			GF lcInv = b.back().inverse();
+			for (std::size_t i = m + 1; i > n; i--) {
+				GF factor = a[i-1] * lcInv;
+				if (factor.isZero()) continue;
+				for (std::size_t k = 0; k <= n; k++) {
+					a[i-1-n+k] = a[i-1-n+k] - factor * b[k];
+				}
+			}
+			a.resize(n);
+			while (!a.empty() && a.back().isZero()) a.pop_back();
+			if (a.empty()) return GF(0, gf);
+			// res(a, b) = (-1)^(mn) * lc(b)^(m - deg(r)) * res(b, r)
+			if (m % 2 == 1 && n % 2 == 1) res = -res;
+			res = res * pow(b.back(), m + 1 - a.size());
+			std::swap(a, b);
+		}
+	}
+
+	/**
+	 * Computes the resultant of two polynomials modulo a single prime.
+	 */
+	class ModularImage {
+		const GaloisField<sint>* mGF;
+		sint mPrime;
+		/// Degree bounds of the resultant in the variables.
+		const std::vector<std::size_t>& mDegrees;
+
+		/// Substitutes the given value for the given variable and merges the resulting terms.
+		Coefficients<GF> specialize(const Coefficients<GF>& poly, std::size_t var, const GF& value) const {
+			Coefficients<GF> res;
+			std::vector<GF> powers(1, GF(1, mGF));
+			for (const auto& c: poly) {
+				Terms<GF> terms;
+				for (const auto& t: c) {
+					while (powers.size() <= t.first[var]) powers.push_back(powers.back() * value);
+					GF coeff = t.second * powers[t.first[var]];
+					if (coeff.isZero()) continue;
+					terms.emplace_back(t.first, coeff);
+					terms.back().first[var] = 0;
+				}
+				std::sort(terms.begin(), terms.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+				res.emplace_back();
+				for (auto& t: terms) {
+					if (!res.back().empty() && res.back().back().first == t.first) {
+						res.back().back().second = res.back().back().second + t.second;
+						if (res.back().back().second.isZero()) res.back().pop_back();
+					} else {
+						res.back().emplace_back(std::move(t));
+					}
+				}
+			}
+			return res;
+		}
+
+		/// Interpolates the values in the given variable using newton interpolation. Every value is a dense polynomial in the remaining variables.
+		std::vector<GF> interpolate(const std::vector<GF>& points, std::vector<std::vector<GF>>& values) const {
+			std::size_t d = points.size();
+			std::size_t block = values.front().size();
+			// Compute divided differences
+			for (std::size_t k = 1; k < d; k++) {
+				for (std::size_t i = d - 1; i >= k; i--) {
+					GF inv = (points[i] - points[i-k]).inverse();
+					for (std::size_t b = 0; b < block; b++) {
+						values[i][b] = (values[i][b] - values[i-1][b]) * inv;
+					}
+				}
+			}
+			// Convert newton form to dense representation
+			std::vector<GF> res(d * block, GF(0, mGF));
+			for (std::size_t i = d; i > 0; i--) {
+				// res = res * (x - points[i-1]) + values[i-1]
+				for (std::size_t e = d - 1; e > 0; e--) {
+					for (std::size_t b = 0; b < block; b++) {
+						res[e * block + b] = res[(e-1) * block + b] - res[e * block + b] * points[i-1];
+					}
+				}
+				for (std::size_t b = 0; b < block; b++) {
+					res[b] = values[i-1][b] - res[b] * points[i-1];
+				}
+			}
+			return res;
+		}
+	public:
+		ModularImage(Prime prime, const std::vector<std::size_t>& degrees):
+			mGF(GaloisFieldManager<sint>::getInstance().getField(prime)),
+			mPrime(sint(prime)),
+			mDegrees(degrees)
+		{}
+
+		const GaloisField<sint>* gf() const {
+			return mGF;
+		}
+
+		/// Returns the representative of n from \f$[-(p-1)/2, (p-1)/2]\f$, as GFNumber does not enforce a unique representation.
+		sint symmetric(const GF& n) const {
+			sint res = n.representingInteger() % mPrime;
+			if (res > mPrime / 2) res -= mPrime;
+			else if (res < -(mPrime / 2)) res += mPrime;
+			return res;
+		}
+
+		template<typename Integer>
+		Coefficients<GF> reduce(const Coefficients<Integer>& poly) const {
+			Coefficients<GF> res;
+			Integer prime(mPrime);
+			for (const auto& c: poly) {
+				res.emplace_back();
+				for (const auto& t: c) {
+					GF coeff(toInt<sint>(Integer(carl::mod(t.second, prime))), mGF);
+					if (!coeff.isZero()) res.back().emplace_back(t.first, coeff);
+				}
+			}
+			return res;
+		}
+
+		/**
+		 * Computes the resultant of p and q in the first vars variables.
+		 * The result is a dense polynomial where the exponent of variable i has stride \f$\prod_{j<i} (d_j+1)\f$.
+		 * The leading coefficients of p and q are assumed to be nonzero.
+		 * @return false, if the field is too small to provide enough evaluation points.
+		 */
+		bool compute(const Coefficients<GF>& p, const Coefficients<GF>& q, std::size_t vars, std::vector<GF>& res) const {
+			if (vars == 0) {
+				std::vector<GF> a, b;
+				for (const auto& c: p) a.push_back(c.empty() ? GF(0, mGF) : c.front().second);
+				for (const auto& c: q) b.push_back(c.empty() ? GF(0, mGF) : c.front().second);
+				res.assign(1, resultant(std::move(a), std::move(b), mGF));
+				return true;
+			}
+			std::size_t var = vars - 1;
+			std::vector<GF> points;
+			std::vector<std::vector<GF>> values;
+			for (sint t = 0; points.size() <= mDegrees[var]; t++) {
+				if (t >= mPrime) return false;
+				GF point(t, mGF);
+				Coefficients<GF> ps = specialize(p, var, point);
+				if (ps.back().empty()) continue;
+				Coefficients<GF> qs = specialize(q, var, point);
+				if (qs.back().empty()) continue;
+				values.emplace_back();
+				if (!compute(ps, qs, var, values.back())) return false;
+				points.push_back(point);
+			}
+			res = interpolate(points, values);
+			return true;
+		}
+	};
+
+	/**
+	 * Computes the resultant of p and q using the modular algorithm.
+	 * Assumes that p has at least the degree of q and that q is not constant.
+	 */
+	template<typename Coeff>
+	UnivariatePolynomial<Coeff> compute(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+		using Number = typename UnderlyingNumberType<Coeff>::type;
+		using Integer = typename IntegralType<Number>::type;
+		assert(p.degree() >= q.degree() && q.degree() > 0);
+		Input<Number> input = prepare<Coeff, Number>({&p, &q});
+		const auto& P = input.polys[0];
+		const auto& Q = input.polys[1];
+		std::size_t m = P.size() - 1;
+		std::size_t n = Q.size() - 1;
+
+		// Degree bounds of the resultant: deg(res) <= n * deg(P) + m * deg(Q)
+		std::vector<std::size_t> degrees(input.variables.size(), 0);
+		std::vector<std::size_t> strides(input.variables.size() + 1, 1);
+		for (std::size_t v = 0; v < degrees.size(); v++) {
+			std::size_t degP = 0;
+			std::size_t degQ = 0;
+			for (const auto& c: P) for (const auto& t: c) degP = std::max(degP, std::size_t(t.first[v]));
+			for (const auto& c: Q) for (const auto& t: c) degQ = std::max(degQ, std::size_t(t.first[v]));
+			degrees[v] = n * degP + m * degQ;
+			strides[v+1] = strides[v] * (degrees[v] + 1);
+		}
+		// Every term of the sylvester determinant picks n rows of P and m rows of Q, hence |res|_1 <= |P|_1^n * |Q|_1^m.
+		Integer normP = constant_zero<Integer>::get();
+		Integer normQ = constant_zero<Integer>::get();
+		for (const auto& c: P) for (const auto& t: c) normP += carl::abs(t.second);
+		for (const auto& c: Q) for (const auto& t: c) normQ += carl::abs(t.second);
+		Integer bound = Integer(2) * carl::pow(normP, n) * carl::pow(normQ, m);
+		CARL_LOG_DEBUG("carl.core.resultant", "Modular resultant with degree bounds " << degrees << " and coefficient bound " << bound);
+
+		std::vector<Integer> result;
+		Integer modulus = constant_one<Integer>::get();
+		std::size_t confirmed = 0;
+		PrimeFactory<mpz_class> primes;
+		while (modulus <= bound && confirmed < ConfirmingPrimes) {
+			Prime prime = nextPrime(primes);
+			ModularImage image(prime, degrees);
+			Coefficients<GF> Pp = image.reduce(P);
+			Coefficients<GF> Qp = image.reduce(Q);
+			if (Pp.back().empty() || Qp.back().empty()) {
+				CARL_LOG_DEBUG("carl.core.resultant", "Skipping prime " << prime << " as it divides the leading coefficient.");
+				continue;
+			}
+			std::vector<GF> res;
+			if (!image.compute(Pp, Qp, input.variables.size(), res)) {
+				CARL_LOG_DEBUG("carl.core.resultant", "Skipping prime " << prime << " as there are not enough evaluation points.");
+				continue;
+			}
+			if (result.empty()) {
+				for (const auto& r: res) result.emplace_back(image.symmetric(r));
+				modulus = Integer(prime);
+				continue;
+			}
+			// Combine with the previous result such that all coefficients stay within the symmetric range.
+			GF inverse = GF(toInt<sint>(Integer(carl::mod(modulus, Integer(prime)))), image.gf()).inverse();
+			bool changed = false;
+			for (std::size_t i = 0; i < result.size(); i++) {
+				GF old(toInt<sint>(Integer(carl::mod(result[i], Integer(prime)))), image.gf());
+				GF digit = (res[i] - old) * inverse;
+				if (digit.isZero()) continue;
+				result[i] += modulus * Integer(image.symmetric(digit));
+				changed = true;
+			}
+			modulus *= Integer(prime);
+			if (changed) confirmed = 0;
+			else confirmed++;
+		}
+
+		// Convert the result back, undoing the scaling of the inputs.
+		Number factor = carl::pow(input.factors[0], n) * carl::pow(input.factors[1], m);
+		Terms<Number> terms;
+		for (std::size_t i = 0; i < result.size(); i++) {
+			if (isZero(result[i])) continue;
+			Exponents e(degrees.size());
+			for (std::size_t v = 0; v < degrees.size(); v++) {
+				e[v] = uint((i / strides[v]) % (degrees[v] + 1));
+			}
+			terms.emplace_back(std::move(e), Number(result[i]) / factor);
+		}
+		return UnivariatePolynomial<Coeff>(p.mainVar(), fromTerms<Coeff>(std::move(terms), input.variables));
+	}
+
+	/**
+	 * Computes the resultant of p and q using the modular algorithm, if applicable.
+	 * As for the other strategies, the polynomial with the larger degree is used as first argument.
+	 * @return false, if the modular algorithm can not be used.
+	 */
+	template<typename Coeff, EnableIf<is_applicable<Coeff>> = dummy>
+	bool resultant(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q, UnivariatePolynomial<Coeff>& res) {
+		if (p.isConstant() || q.isConstant()) return false;
+		if (p.degree() < q.degree()) res = compute(q, p);
+		else res = compute(p, q);
+		return true;
+	}
+	template<typename Coeff, DisableIf<is_applicable<Coeff>> = dummy>
+	bool resultant(const UnivariatePolynomial<Coeff>&, const UnivariatePolynomial<Coeff>&, UnivariatePolynomial<Coeff>&) {
+		return false;
+	}
+}
+
+}
@@ -5,7 +5,7 @@
 
 namespace carl {
 enum class SubresultantStrategy {
-	Generic, Lazard, Ducos, Default = Lazard
+	Generic, Lazard, Ducos, Modular, Default = Lazard
 };
 
 template<typename Coeff>
@@ -22,6 +22,7 @@ UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, Sub
 }
 
 #include "../UnivariatePolynomial.h"
+#include "ModularResultant.h"
 
 namespace carl {
 
@@ -143,7 +144,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 					break;
 				}
 				case SubresultantStrategy::Ducos:
-				case SubresultantStrategy::Lazard: {
+				case SubresultantStrategy::Lazard:
+				case SubresultantStrategy::Modular: {
 					CARL_LOG_TRACE("carl.core.resultant", "Part 2: Ducos/Lazard strategy");
 					// "dichotomous Lazard": efficient exponentiation
 					uint deltaReduced = delta-1;
@@ -200,7 +202,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 		switch (strategy) {
 			// Compared to [Duc98], here S_{d-1} is b and S_d is a, S_e is c, and s_d is subresLcoeff.
 			case SubresultantStrategy::Generic:
-			case SubresultantStrategy::Lazard: {
+			case SubresultantStrategy::Lazard:
+			case SubresultantStrategy::Modular: {
 				CARL_LOG_TRACE("carl.core.resultant", "Part 3: Generic/Lazard strategy");
 				if (p.isZero()) return subresultants;
 				
@@ -283,7 +286,12 @@ UnivariatePolynomial<Coeff> resultant(
 ) {
 	assert(p.mainVar() == q.mainVar());
 	if (p.isZero() || q.isZero()) return UnivariatePolynomial<Coeff>(p.mainVar());
-	UnivariatePolynomial<Coeff> resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
+	UnivariatePolynomial<Coeff> resultant(p.mainVar());
+	if (strategy == SubresultantStrategy::Modular && modular_resultant::resultant(p.normalized(), q.normalized(), resultant)) {
+		CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
+		return resultant;
+	}
+	resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
 	CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
 	if (resultant.isConstant()) {
 		return resultant;
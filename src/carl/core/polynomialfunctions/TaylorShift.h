@@ -0,0 +1,124 @@
+/**
+ * @file TaylorShift.h
+ *
+ * Implements Taylor shifts, that is the computation of p(x + a) for a dense coefficient vector of p.
+ * Besides the classical quadratic method, the divide-and-conquer method from @cite GathenGerhard97 is implemented.
+ * Together with Karatsuba multiplication, it is asymptotically faster for large degrees.
+ */
+
+#pragma once
+
+#include "../../numbers/numbers.h"
+
+#include <vector>
+
+namespace carl {
+
+namespace taylor_shift {
+
+	/// Below this size, polynomials are multiplied by the schoolbook method.
+	static constexpr std::size_t KaratsubaThreshold = 32;
+	/// Below this size, Taylor shifts are computed by the classical method.
+	static constexpr std::size_t DivideAndConquerThreshold = 64;
+
+	/// Adds b, multiplied by x^offset, to a.
+	template<typename T>
+	void add(std::vector<T>& a, const std::vector<T>& b, std::size_t offset = 0) {
+		if (a.size() < b.size() + offset) a.resize(b.size() + offset, constant_zero<T>::get());
+		for (std::size_t i = 0; i < b.size(); i++) a[i + offset] += b[i];
+	}
+
+	/// Subtracts b from a.
+	template<typename T>
+	void subtract(std::vector<T>& a, const std::vector<T>& b) {
+		if (a.size() < b.size()) a.resize(b.size(), constant_zero<T>::get());
+		for (std::size_t i = 0; i < b.size(); i++) a[i] -= b[i];
+	}
+
+	/// Multiplies two dense polynomials using Karatsuba's method.
+	template<typename T>
+	std::vector<T> multiply(const std::vector<T>& a, const std::vector<T>& b) {
+		if (a.empty() || b.empty()) return {};
+		if (std::min(a.size(), b.size()) < KaratsubaThreshold) {
+			std::vector<T> res(a.size() + b.size() - 1, constant_zero<T>::get());
+			for (std::size_t i = 0; i < a.size(); i++) {
+				if (isZero(a[i])) continue;
+				for (std::size_t j = 0; j < b.size(); j++) res[i + j] += a[i] * b[j];
+			}
+			return res;
+		}
+		std::size_t h = std::max(a.size(), b.size()) / 2;
+		auto low = [h](const std::vector<T>& p){ return std::vector<T>(p.begin(), p.begin() + std::ptrdiff_t(std::min(h, p.size()))); };
+		auto high = [h](const std::vector<T>& p){ return h < p.size() ? std::vector<T>(p.begin() + std::ptrdiff_t(h), p.end()) : std::vector<T>(); };
+		std::vector<T> a0 = low(a), a1 = high(a);
+		std::vector<T> b0 = low(b), b1 = high(b);
+		std::vector<T> z0 = multiply(a0, b0);
+		std::vector<T> z2 = multiply(a1, b1);
+		add(a0, a1);
+		add(b0, b1);
+		std::vector<T> z1 = multiply(a0, b0);
+		subtract(z1, z0);
+		subtract(z1, z2);
+		std::vector<T> res(a.size() + b.size() - 1, constant_zero<T>::get());
+		add(res, z0);
+		add(res, z1, h);
+		add(res, z2, 2 * h);
+		res.resize(a.size() + b.size() - 1);
+		return res;
+	}
+
+	/// Computes the Taylor shift by the classical method using O(n^2) operations.
+	template<typename T>
+	void classical(std::vector<T>& p, const T& a) {
+		if (p.size() < 2) return;
+		std::size_t n = p.size() - 1;
+		bool one = isOne(a);
+		for (std::size_t i = 0; i < n; i++) {
+			for (std::size_t j = n; j-- > i;) {
+				if (one) p[j] += p[j + 1];
+				else p[j] += a * p[j + 1];
+			}
+		}
+	}
+
+	/**
+	 * Computes the Taylor shift by divide-and-conquer.
+	 * The polynomial is split as p = p_0 + x^m p_1 where m is a power of two, and p(x + a) = p_0(x + a) + (x + a)^m p_1(x + a).
+	 * @param p Polynomial.
+	 * @param powers The powers (x + a)^(2^i).
+	 */
+	template<typename T>
+	std::vector<T> divideAndConquer(std::vector<T> p, const std::vector<std::vector<T>>& powers) {
+		if (p.size() < DivideAndConquerThreshold) {
+			classical(p, powers.front().front());
+			return p;
+		}
+		std::size_t i = 0;
+		while ((std::size_t(2) << i) < p.size()) i++;
+		std::size_t m = std::size_t(1) << i;
+		std::vector<T> res = divideAndConquer(std::vector<T>(p.begin(), p.begin() + std::ptrdiff_t(m)), powers);
+		add(res, multiply(powers[i], divideAndConquer(std::vector<T>(p.begin() + std::ptrdiff_t(m), p.end()), powers)));
+		return res;
+	}
+}
+
+/**
+ * Replaces the dense polynomial p by p(x + a).
+ * Uses the divide-and-conquer method for large degrees and the classical method otherwise.
+ * @param p Coefficients of the polynomial, starting with the constant coefficient.
+ * @param a Offset.
+ */
+template<typename T>
+void taylorShift(std::vector<T>& p, const T& a) {
+	if (p.size() < taylor_shift::DivideAndConquerThreshold) {
+		taylor_shift::classical(p, a);
+		return;
+	}
+	std::vector<std::vector<T>> powers({{a, constant_one<T>::get()}});
+	while ((std::size_t(1) << powers.size()) < p.size()) {
+		powers.push_back(taylor_shift::multiply(powers.back(), powers.back()));
+	}
+	p = taylor_shift::divideAndConquer(std::move(p), powers);
+}
+
+}
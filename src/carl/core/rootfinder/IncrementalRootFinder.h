@@ -8,6 +8,7 @@
 
 #include "../logging.h"
 
+#include <complex>
 #include <queue>
 
 namespace carl {
@@ -52,6 +53,8 @@ enum class SplittingStrategy {
 	EIGENVALUES,
 	/// Uses AberthStrategy for first step, BinarySampleStrategy afterwards
 	ABERTH,
+	/// Uses DescartesStrategy to isolate all roots at once
+	DESCARTES,
 	/// Defaults to EIGENVALUES
 	DEFAULT = EIGENVALUES
 };
@@ -70,6 +73,7 @@ inline std::ostream& operator<<(std::ostream& os, const SplittingStrategy& s) {
 		case SplittingStrategy::GRID: return os << "Grid";
 		case SplittingStrategy::EIGENVALUES: return os << "Eigenvalues";
 		case SplittingStrategy::ABERTH: return os << "Aberth";
+		case SplittingStrategy::DESCARTES: return os << "Descartes";
 	}
 }
 
@@ -188,11 +192,48 @@ struct EigenValueStrategy: AbstractStrategy<EigenValueStrategy<Number>, Number>
  */
 template<typename Number>
 struct AberthStrategy : AbstractStrategy<AberthStrategy<Number>, Number> {
-	std::vector<double> teruiSasaki(const UnivariatePolynomial<Number>& p, uint rootCount);
-	double step(std::vector<double>& roots, const UnivariatePolynomial<Number>& p, const UnivariatePolynomial<Number>& pd);
-	Number step(std::vector<Number>& roots, const UnivariatePolynomial<Number>& p, const UnivariatePolynomial<Number>& pd);
-	bool Aberth(const UnivariatePolynomial<Number>& polynomial, std::vector<double>& roots, const double epsilon = 0.01);
+	/// Relative accuracy up to which the approximations are computed.
+	double epsilon = 1e-12;
+	/// Maximum number of iterations of Aberths method.
+	std::size_t maxIterations = 500;
 
+	/**
+	 * Approximates all complex roots of a polynomial in double precision using the Aberth-Ehrlich iteration.
+	 * Additionally, for every approximation \f$z\f$ the radius \f$n |p(z) / p'(z)|\f$ of a disc around \f$z\f$ that contains a root is computed.
+	 * @param p Polynomial.
+	 * @param roots Approximations.
+	 * @param radii Inclusion radii.
+	 * @return If the iteration converged and all values are finite.
+	 */
+	bool approximate(const UnivariatePolynomial<Number>& p, std::vector<std::complex<double>>& roots, std::vector<double>& radii) const;
+
+	/**
+	 * Given an interval \f$(a,b)\f$, the real root approximations are used to split it into intervals \f$(a, s_1), [s_1], ..., [s_k], (s_k, b)\f$ such that every interval contains one approximation.
+	 * The separators are simple numbers outside of the inclusion discs of the approximations.
+	 * Every interval is certified by an exact check of the sign variations: intervals without variations are dropped, intervals with a single variation are added as roots.
+	 * Only the remaining intervals are queued for the BinarySampleStrategy, as is the whole interval if the approximation fails.
+	 * @param interval Interval.
+	 * @param finder Finder object.
+	 */
+	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
+};
+
+
+/**
+ * Implements the isolation of all roots by Descartes' rule of signs due to Vincent, Collins and Akritas @cite CollinsAkritas76.
+ * If IntegerArithmetic is set, the transformed polynomials are represented with integer coefficients.
+ * Otherwise, the coefficients are of type Number.
+ */
+template<typename Number, bool IntegerArithmetic = true>
+struct DescartesStrategy : AbstractStrategy<DescartesStrategy<Number, IntegerArithmetic>, Number> {
+	/**
+	 * Given an interval \f$(a,b)\f$, the polynomial is transformed such that its roots in \f$(a,b)\f$ are mapped to \f$(0,1)\f$.
+	 * Then, \f$(0,1)\f$ is bisected until each subinterval has at most one sign variation.
+	 * The polynomials of the subintervals are obtained by Taylor shifts (see carl::taylorShift) of the polynomial of the parent interval.
+	 * All roots in \f$(a,b)\f$ are added to the finder, no new intervals are queued.
+	 * @param interval Interval.
+	 * @param finder Finder object.
+	 */
 	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
 };
 
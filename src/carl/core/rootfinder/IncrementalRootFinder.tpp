@@ -8,6 +8,8 @@
 
 #include "../../util/debug.h"
 #include "../logging.h"
+#include "../polynomialfunctions/TaylorShift.h"
+#include "../Sign.h"
 #include "AbstractRootFinder.h"
 #include "RootFinder.h"
 
@@ -51,13 +53,18 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 	
 	CARL_LOG_TRACE("carl.core.rootfinder", "Processing " << interval);
 
-	if (strategy == SplittingStrategy::EIGENVALUES) {
+	if (strategy == SplittingStrategy::DESCARTES) {
+		splitting_strategies::DescartesStrategy<Number>::getInstance()(interval, *this);
+		CARL_LOG_TRACE("carl.core.rootfinder", "Called Descartes strategy");
+		return true;
+	} else if (strategy == SplittingStrategy::EIGENVALUES) {
 		splitting_strategies::EigenValueStrategy<Number>::getInstance()(interval, *this);
 		CARL_LOG_TRACE("carl.core.rootfinder", "Called Eigenvalue strategy");
 		return true;
 	} else if (strategy == SplittingStrategy::ABERTH) {
-		//AberthStrategy<Number>::instance()(interval, *this);
-		//return true;
+		splitting_strategies::AberthStrategy<Number>::getInstance()(interval, *this);
+		CARL_LOG_TRACE("carl.core.rootfinder", "Called Aberth strategy");
+		return true;
 	}
 
 	if (interval.contains(0)) {
@@ -89,6 +96,7 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 			break;
 		case SplittingStrategy::EIGENVALUES:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::ABERTH:		// Should not happen, safe fallback anyway
+		case SplittingStrategy::DESCARTES:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::BINARYSAMPLE: splitting_strategies::BinarySampleStrategy<Number>::getInstance()(interval, *this);
 			break;
 		case SplittingStrategy::BINARYNEWTON: splitting_strategies::BinaryNewtonStrategy<Number>::getInstance()(interval, *this);
@@ -233,6 +241,249 @@ void EigenValueStrategy<Number>::operator()(const Interval<Number>& interval, Ro
 	buildIsolation(eigen::root_approximation(coeffs), interval, finder);
 }
 
+namespace aberth {
+	/**
+	 * Computes \f$p(z) / p'(z)\f$ in double precision.
+	 * For \f$|z| > 1\f$, the reversed polynomial \f$q(w) = w^n p(1/w)\f$ is evaluated at \f$w = 1/z\f$ to avoid overflows, using \f$p(z) / p'(z) = z q(w) / (n q(w) - w q'(w))\f$.
+	 */
+	inline std::complex<double> newtonCorrection(const std::vector<double>& p, const std::complex<double>& z) {
+		std::size_t n = p.size() - 1;
+		std::complex<double> value;
+		std::complex<double> derivative;
+		if (std::abs(z) <= 1) {
+			value = p[n];
+			for (std::size_t i = n; i-- > 0;) {
+				derivative = derivative * z + value;
+				value = value * z + p[i];
+			}
+			return value / derivative;
+		}
+		std::complex<double> w = 1.0 / z;
+		value = p[0];
+		for (std::size_t i = 1; i <= n; i++) {
+			derivative = derivative * w + value;
+			value = value * w + p[i];
+		}
+		return z * value / (double(n) * value - w * derivative);
+	}
+}
+
+template<typename Number>
+bool AberthStrategy<Number>::approximate(const UnivariatePolynomial<Number>& p, std::vector<std::complex<double>>& roots, std::vector<double>& radii) const {
+	std::vector<double> coeffs;
+	for (const auto& c: p.coefficients()) {
+		coeffs.push_back(toDouble(c));
+		if (!std::isfinite(coeffs.back())) return false;
+	}
+	std::size_t n = coeffs.size() - 1;
+	if (n == 0 || coeffs[n] == 0) return false;
+	// Start on a circle whose radius is about the largest absolute value of the roots.
+	double radius = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		radius = std::max(radius, std::pow(std::abs(coeffs[i] / coeffs[n]), 1.0 / double(n - i)));
+	}
+	if (radius == 0 || !std::isfinite(radius)) radius = 1;
+	roots.clear();
+	for (std::size_t k = 0; k < n; k++) {
+		roots.push_back(std::polar(radius, 2 * std::acos(-1.0) * double(k) / double(n) + 0.4));
+	}
+	std::vector<bool> converged(n, false);
+	std::size_t count = 0;
+	for (std::size_t iteration = 0; iteration < maxIterations && count < n; iteration++) {
+		for (std::size_t k = 0; k < n; k++) {
+			if (converged[k]) continue;
+			std::complex<double> ratio = aberth::newtonCorrection(coeffs, roots[k]);
+			std::complex<double> sum;
+			for (std::size_t j = 0; j < n; j++) {
+				if (j != k) sum += 1.0 / (roots[k] - roots[j]);
+			}
+			std::complex<double> delta = ratio / (1.0 - ratio * sum);
+			if (!std::isfinite(delta.real()) || !std::isfinite(delta.imag())) return false;
+			roots[k] -= delta;
+			if (std::abs(delta) <= epsilon * std::abs(roots[k])) {
+				converged[k] = true;
+				count++;
+			}
+		}
+	}
+	CARL_LOG_DEBUG("carl.core.rootfinder", "Aberth iteration converged for " << count << " of " << n << " roots");
+	if (count < n) return false;
+	radii.clear();
+	for (const auto& z: roots) {
+		radii.push_back(double(n) * std::abs(aberth::newtonCorrection(coeffs, z)));
+		if (!std::isfinite(radii.back())) return false;
+	}
+	return true;
+}
+
+template<typename Number>
+void AberthStrategy<Number>::operator()(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	std::vector<std::complex<double>> roots;
+	std::vector<double> radii;
+	if (!approximate(finder.getPolynomial(), roots, radii)) {
+		CARL_LOG_DEBUG("carl.core.rootfinder", "Approximation failed, falling back to bisection on " << interval);
+		finder.addQueue(interval, SplittingStrategy::BINARYSAMPLE);
+		return;
+	}
+	// Approximations whose inclusion discs meet the real axis, overlapping ones are merged.
+	std::vector<std::pair<double,double>> candidates;
+	for (std::size_t k = 0; k < roots.size(); k++) {
+		if (std::abs(roots[k].imag()) > radii[k]) continue;
+		candidates.emplace_back(roots[k].real() - radii[k], roots[k].real() + radii[k]);
+	}
+	std::sort(candidates.begin(), candidates.end());
+	std::vector<std::pair<double,double>> merged;
+	for (const auto& c: candidates) {
+		if (!merged.empty() && c.first <= merged.back().second) {
+			merged.back().second = std::max(merged.back().second, c.second);
+		} else {
+			merged.push_back(c);
+		}
+	}
+	CARL_LOG_DEBUG("carl.core.rootfinder", "Found " << merged.size() << " real root candidates");
+
+	std::vector<Number> bounds({interval.lower()});
+	for (std::size_t i = 0; i + 1 < merged.size(); i++) {
+		Number lower = carl::rationalize<Number>(merged[i].second);
+		Number upper = carl::rationalize<Number>(merged[i+1].first);
+		Number separator = Interval<Number>(lower, BoundType::STRICT, upper, BoundType::STRICT).sample(false);
+		if (separator <= bounds.back() || separator >= interval.upper()) continue;
+		bounds.push_back(separator);
+	}
+	bounds.push_back(interval.upper());
+
+	for (std::size_t i = 0; i + 1 < bounds.size(); i++) {
+		if (i > 0 && finder.getPolynomial().isRoot(bounds[i])) {
+			finder.addRoot(RealAlgebraicNumber<Number>(bounds[i]));
+		}
+		Interval<Number> candidate(bounds[i], BoundType::STRICT, bounds[i+1], BoundType::STRICT);
+		const auto& p = finder.getPolynomial();
+		uint variations = p.signVariations(candidate);
+		if (variations == 0) continue;
+		if (variations == 1 && !p.isRoot(candidate.lower()) && !p.isRoot(candidate.upper())) {
+			CARL_LOG_TRACE("carl.core.rootfinder", "Certified isolating interval " << candidate);
+			finder.addRoot(candidate);
+			continue;
+		}
+		CARL_LOG_DEBUG("carl.core.rootfinder", "Certification failed for " << candidate << ", falling back to bisection");
+		finder.addQueue(candidate, SplittingStrategy::BINARYSAMPLE);
+	}
+}
+
+namespace descartes {
+	/// Returns the number of sign variations of \f$(x+1)^n p(1/(x+1))\f$, which bounds the number of roots of p in \f$(0,1)\f$.
+	template<typename T>
+	std::size_t variations(const std::vector<T>& p) {
+		if (signVariations(p.begin(), p.end(), [](const T& c){ return carl::sgn(c); }) == 0) return 0;
+		std::vector<T> r(p.rbegin(), p.rend());
+		taylorShift(r, constant_one<T>::get());
+		return signVariations(r.begin(), r.end(), [](const T& c){ return carl::sgn(c); });
+	}
+
+	/// Replaces p by \f$2^n p(x/2)\f$.
+	template<typename T>
+	void halve(std::vector<T>& p) {
+		T factor = constant_one<T>::get();
+		for (std::size_t i = p.size(); i-- > 0;) {
+			p[i] *= factor;
+			factor *= 2;
+		}
+	}
+
+	/// Divides p by \f$x-1\f$, assuming that 1 is a root of p.
+	template<typename T>
+	void divideByXMinusOne(std::vector<T>& p) {
+		for (std::size_t i = p.size() - 1; i-- > 0;) p[i] += p[i+1];
+		assert(isZero(p.front()));
+		p.erase(p.begin());
+	}
+
+	/// Divides integral coefficients by their content to keep them small.
+	template<typename T, EnableIf<is_integer<T>> = dummy>
+	void reduce(std::vector<T>& p) {
+		T content = constant_zero<T>::get();
+		for (const auto& c: p) {
+			content = carl::gcd(content, c);
+			if (isOne(content)) return;
+		}
+		if (isZero(content)) return;
+		for (auto& c: p) c = carl::div(c, content);
+	}
+	template<typename T, DisableIf<is_integer<T>> = dummy>
+	void reduce(std::vector<T>&) {}
+
+	/**
+	 * Isolates the roots of a polynomial within an interval, given as a polynomial whose roots in \f$(0,1)\f$ correspond to the roots in the interval.
+	 * @param p Transformed polynomial.
+	 * @param interval Interval.
+	 * @param finder Finder object.
+	 */
+	template<typename T, typename Number>
+	void isolate(std::vector<T>&& p, const Interval<Number>& interval, RootFinder<Number>& finder) {
+		// Roots at the bounds do not belong to the interval, hence we remove them.
+		while (!p.empty() && isZero(p.front())) p.erase(p.begin());
+		T sum = constant_zero<T>::get();
+		for (const auto& c: p) sum += c;
+		if (p.size() > 1 && isZero(sum)) divideByXMinusOne(p);
+		reduce(p);
+
+		// Stack of polynomials together with the lower bound and the width of their intervals.
+		std::vector<std::tuple<std::vector<T>, Number, Number>> stack;
+		stack.emplace_back(std::move(p), interval.lower(), interval.diameter());
+		while (!stack.empty()) {
+			std::vector<T> left = std::move(std::get<0>(stack.back()));
+			Number lower = std::get<1>(stack.back());
+			Number width = std::get<2>(stack.back());
+			stack.pop_back();
+			if (left.size() < 2) continue;
+			std::size_t v = variations(left);
+			CARL_LOG_TRACE("carl.core.rootfinder", "Sign variations in (" << lower << ", " << Number(lower + width) << "): " << v);
+			if (v == 0) continue;
+			if (v == 1) {
+				finder.addRoot(Interval<Number>(lower, BoundType::STRICT, lower + width, BoundType::STRICT));
+				continue;
+			}
+			Number half = width / 2;
+			halve(left);
+			std::vector<T> right = left;
+			taylorShift(right, constant_one<T>::get());
+			if (isZero(right.front())) {
+				finder.addRoot(RealAlgebraicNumber<Number>(lower + half));
+				right.erase(right.begin());
+				divideByXMinusOne(left);
+			}
+			reduce(left);
+			reduce(right);
+			stack.emplace_back(std::move(right), lower + half, half);
+			stack.emplace_back(std::move(left), lower, half);
+		}
+	}
+}
+
+template<typename Number, bool IntegerArithmetic>
+void DescartesStrategy<Number, IntegerArithmetic>::operator()(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	using Integer = typename IntegralType<Number>::type;
+	assert(interval.lowerBoundType() == BoundType::STRICT && interval.upperBoundType() == BoundType::STRICT);
+	// Transform such that the roots in the interval are mapped to (0,1).
+	std::vector<Number> coeffs = finder.getPolynomial().coefficients();
+	taylorShift(coeffs, interval.lower());
+	Number factor = constant_one<Number>::get();
+	for (auto& c: coeffs) {
+		c *= factor;
+		factor *= interval.diameter();
+	}
+	if (IntegerArithmetic) {
+		Integer denominator = constant_one<Integer>::get();
+		for (const auto& c: coeffs) denominator = carl::lcm(denominator, getDenom(c));
+		std::vector<Integer> p;
+		p.reserve(coeffs.size());
+		for (const auto& c: coeffs) p.push_back(getNum(Number(c * denominator)));
+		descartes::isolate(std::move(p), interval, finder);
+	} else {
+		descartes::isolate(std::move(coeffs), interval, finder);
+	}
+}
+
 }
 
 }
@@ -75,7 +75,7 @@ boost::optional<std::vector<RealAlgebraicNumber<Number>>> realRoots(
 			CARL_LOG_TRACE("carl.core.rootfinder", "Checking " << polyCopy.mainVar() << " = " << *it);
 			IRmap[polyCopy.mainVar()] = *it;
 			CARL_LOG_TRACE("carl.core.rootfinder", "Evaluating " << mvpoly << " on " << IRmap);
-			if (!RealAlgebraicNumberEvaluation::evaluate(mvpoly, IRmap).isZero()) {
+			if (RealAlgebraicNumberEvaluation::evaluateSign(mvpoly, IRmap) != Sign::ZERO) {
 				CARL_LOG_TRACE("carl.core.rootfinder", "Purging spurious root " << *it);
 				it = res.erase(it);
 			} else {
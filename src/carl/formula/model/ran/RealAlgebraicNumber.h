@@ -252,7 +252,7 @@ public:
 	const auto& getIRSturmSequence() const {
 		assert(!isNumeric());
 		assert(isInterval());
-		return mIR->sturmSequence;
+		return mIR->getSturmSequence();
 	}
 
 	RealAlgebraicNumber changeVariable(Variable v) const {
@@ -333,8 +333,9 @@ public:
 		if (isInterval()) mIR->refineToIntegrality();
 		checkForSimplification();
 	}
-	void refine() const {
-		if (isInterval()) mIR->refine();
+	/// Refines the interval representation using the given strategy.
+	void refine(RealAlgebraicNumberSettings::RefinementStrategy strategy = RealAlgebraicNumberSettings::RefinementStrategy::DEFAULT) const {
+		if (isInterval()) mIR->refine(strategy);
 		checkForSimplification();
 	}
 
@@ -7,6 +7,7 @@
  * get the resulting polynomial or algebraic real.
  */
 
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "../../../interval/IntervalEvaluation.h"
 #include "../../../thom/ThomEvaluation.h"
 #include "../../../util/SFINAE.h"
+#include "../../../util/Singleton.h"
 
 namespace carl {
 namespace RealAlgebraicNumberEvaluation {
@@ -28,6 +30,31 @@ namespace RealAlgebraicNumberEvaluation {
 template <typename Number>
 using RANMap = std::map<Variable, RealAlgebraicNumber<Number>>;
 
+/**
+ * Counts how often each tier of evaluateSign() decides the sign.
+ */
+struct SignStatistics: Singleton<SignStatistics> {
+	/// Number of signs of polynomials that become constant after plugging in the numeric assignments.
+	std::atomic<std::size_t> numeric{0};
+	/// Number of signs decided by interval arithmetic on the given isolating intervals.
+	std::atomic<std::size_t> interval{0};
+	/// Number of signs decided by interval arithmetic after refining the isolating intervals.
+	std::atomic<std::size_t> refined{0};
+	/// Number of signs computed exactly.
+	std::atomic<std::size_t> exact{0};
+
+	void reset() {
+		numeric = 0;
+		interval = 0;
+		refined = 0;
+		exact = 0;
+	}
+};
+
+inline std::ostream& operator<<(std::ostream& os, const SignStatistics& s) {
+	return os << s.numeric << " numeric, " << s.interval << " interval, " << s.refined << " refined, " << s.exact << " exact";
+}
+
 /**
  * Evaluate the given polynomial 'p' at the given 'point' based on the variable order given by 'variables'.
  * If a variable is assigned a numeric representation, the corresponding value is directly plugged in.
@@ -49,6 +76,23 @@ RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Number>& p, co
 template<typename Number>
 RealAlgebraicNumber<Number> evaluateIR(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m);
 
+/**
+ * Compute the sign of the given polynomial 'p' at the point represented by 'm'.
+ * The sign is first computed by interval arithmetic on the isolating intervals of the interval representations.
+ * If the resulting interval contains zero, the isolating intervals are refined until they have been refined RealAlgebraicNumberSettings::SIGN_FILTER_REFINEMENTS times.
+ * Only if the sign is still ambiguous, it is computed exactly using <code>evaluate(MultivariatePolynomial, RANMap)</code>.
+ * Note that variables of 'p' must be assigned in 'm'.
+ */
+template<typename Number>
+Sign evaluateSign(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m);
+
+/**
+ * Compute the sign of the given polynomial 'p' at the given 'point' based on the variable order given by 'variables'.
+ * See <code>evaluateSign(MultivariatePolynomial, RANMap)</code>.
+ */
+template<typename Number, typename Coeff>
+Sign evaluateSign(const MultivariatePolynomial<Coeff>& p, const RealAlgebraicPoint<Number>& point, const std::vector<Variable>& variables);
+
 /**
  * Compute a univariate polynomial with rational coefficients that has the roots of 'p' whose coefficient variables have been substituted by the roots given in m.
  * The map varToInterval gives back an assignment of variables to the isolating intervals of the roots for each variable.
@@ -147,6 +191,62 @@ RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Number>& p, co
 	}
 }
 
+template<typename Number>
+Sign evaluateSign(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m) {
+	CARL_LOG_TRACE("carl.ran", "Evaluating sign of " << p << " on " << m);
+	auto& statistics = SignStatistics::getInstance();
+	for (std::size_t refinements = 0; ; refinements++) {
+		MultivariatePolynomial<Number> pol(p);
+		std::map<Variable, Interval<Number>> intervals;
+		bool exact = false;
+		for (const auto& r: m) {
+			if (!pol.has(r.first)) continue;
+			if (r.second.isNumeric()) {
+				pol.substituteIn(r.first, MultivariatePolynomial<Number>(r.second.value()));
+			} else if (r.second.isInterval()) {
+				intervals.emplace(r.first, r.second.getInterval());
+			} else {
+				exact = true;
+			}
+		}
+		if (pol.isNumber()) {
+			statistics.numeric++;
+			return carl::sgn(pol.constantPart());
+		}
+		if (exact) break;
+		// The closure of the resulting interval contains the value, hence strict comparisons with zero suffice.
+		Interval<Number> res = IntervalEvaluation::evaluate(pol, intervals);
+		Sign sign = Sign::ZERO;
+		if (res.lowerBoundType() != BoundType::INFTY && res.lower() > carl::constant_zero<Number>::get()) sign = Sign::POSITIVE;
+		else if (res.upperBoundType() != BoundType::INFTY && res.upper() < carl::constant_zero<Number>::get()) sign = Sign::NEGATIVE;
+		if (sign != Sign::ZERO) {
+			CARL_LOG_TRACE("carl.ran", "Interval evaluation after " << refinements << " refinements yields " << res);
+			if (refinements == 0) statistics.interval++;
+			else statistics.refined++;
+			return sign;
+		}
+		bool refined = false;
+		for (const auto& i: intervals) {
+			const auto& ran = m.at(i.first);
+			if (ran.getRefinementCount() >= RealAlgebraicNumberSettings::SIGN_FILTER_REFINEMENTS) continue;
+			ran.refine();
+			refined = true;
+		}
+		if (!refined) break;
+	}
+	statistics.exact++;
+	return evaluate(p, m).sgn();
+}
+
+template<typename Number, typename Coeff>
+Sign evaluateSign(const MultivariatePolynomial<Coeff>& p, const RealAlgebraicPoint<Number>& point, const std::vector<Variable>& variables) {
+	assert(point.dim() == variables.size());
+	RANMap<Number> RANs;
+	for (std::size_t i = 0; i < point.dim(); i++) {
+		if (p.has(variables[i])) RANs.emplace(variables[i], point[i]);
+	}
+	return evaluateSign(MultivariatePolynomial<Number>(p), RANs);
+}
 
 /**
  * Evaluate the given polynomial with the given values for the variables.
@@ -16,12 +16,17 @@ enum class RefinementStrategy {
 	BINARYSAMPLE,
 	/// Newton's iteration is applied for finding the a root first. If no root was found, the value is used to dissect the interval.
 	BINARYNEWTON,
-	DEFAULT = BINARYSAMPLE
+	/// Quadratic interval refinement: secant steps on a grid that is refined quadratically on success. Falls back to BINARYSAMPLE if a secant step fails.
+	QIR,
+	DEFAULT = QIR
 };
 
 /// Maximum number of refinements in which the sample() value should be computed for splitting. Otherwise the midpoint is taken.
 static const std::size_t MAXREFINE = 8;
 
+/// Number of refinements up to which an isolating interval is refined to decide the sign of a polynomial by interval arithmetic. Counts all refinements of the number, such that repeated evaluations do not refine it further.
+static const std::size_t SIGN_FILTER_REFINEMENTS = 8;
+
 /// Maximum bound of an isolating interval so that the OpenInterval::sample method is used for splitting point selection.
 static const std::size_t MAX_FASTSAMPLE_BOUND = SHRT_MAX;
 /// Maximum denominator for the sample search is bounded to the square of the common denominator of the bounds; anything above that value is disregarded and a maybe non-optimal, intermediate value is returned instead
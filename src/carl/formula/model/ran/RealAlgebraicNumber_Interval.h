@@ -3,11 +3,34 @@
 #include "../../../core/UnivariatePolynomial.h"
 
 #include "../../../interval/Interval.h"
+#include "../../../util/Singleton.h"
+#include "RealAlgebraicNumberSettings.h"
 
+#include <atomic>
 #include <list>
+#include <mutex>
 
 namespace carl {
 namespace ran {
+	/**
+	 * Statistics of the refinement of interval representations.
+	 * The counters are shared by all numbers, they can be reset before and read after some computation, for example the lifting of the CAD, to measure the number of refinement steps.
+	 */
+	struct Refinement: Singleton<Refinement> {
+		/// Number of bisection steps.
+		std::atomic<std::size_t> bisections{0};
+		/// Number of successful secant steps of the quadratic interval refinement.
+		std::atomic<std::size_t> secantSteps{0};
+		/// Number of failed secant steps of the quadratic interval refinement.
+		std::atomic<std::size_t> failedSecantSteps{0};
+
+		void resetCounters() {
+			bisections = 0;
+			secantSteps = 0;
+			failedSecantSteps = 0;
+		}
+	};
+
   /**
    * FIX isn't this the standard representation of a real algebraic number?
    */
@@ -19,8 +42,15 @@ namespace ran {
 		
 		Polynomial polynomial;
 		Interval<Number> interval;
-		std::list<Polynomial> sturmSequence;
+		/// Sturm sequence of the polynomial, computed on demand. An empty sequence has not been computed yet.
+		mutable std::list<Polynomial> sturmSequence;
+#ifdef THREAD_SAFE
+		/// Guards sturmSequence, as the content is shared by all copies of a number.
+		mutable std::mutex sturmMutex;
+#endif
 		std::size_t refinementCount;
+		/// The quadratic interval refinement splits the interval into \f$2^{qirExponent}\f$ parts.
+		std::size_t qirExponent = 2;
 		
 		Polynomial replaceVariable(const Polynomial& p) const {
 			return p.replaceVariable(auxVariable);
@@ -32,7 +62,6 @@ namespace ran {
 		):
 			polynomial(replaceVariable(p)),
 			interval(i),
-			sturmSequence(p.standardSturmSequence()),
 			refinementCount(0)
 		{}
 		
@@ -52,7 +81,18 @@ namespace ran {
 		
 		void setPolynomial(const Polynomial& p) {
 			polynomial = replaceVariable(p);
-			sturmSequence = polynomial.standardSturmSequence();
+#ifdef THREAD_SAFE
+			std::lock_guard<std::mutex> guard(sturmMutex);
+#endif
+			sturmSequence.clear();
+		}
+
+		const std::list<Polynomial>& getSturmSequence() const {
+#ifdef THREAD_SAFE
+			std::lock_guard<std::mutex> guard(sturmMutex);
+#endif
+			if (sturmSequence.empty()) sturmSequence = polynomial.standardSturmSequence();
+			return sturmSequence;
 		}
 		
 		Sign sgn(const Polynomial& p) const {
@@ -71,21 +111,92 @@ namespace ran {
 			}
 		}
 		
-		void refine() {
+		/**
+		 * Checks whether the root is in the lower part of the interval when splitting at pivot, assuming that pivot is not a root.
+		 * If the polynomial changes its sign on the interval, the sign at pivot suffices. Otherwise, the sturm sequence is used.
+		 */
+		bool rootBelow(const Number& pivot) const {
+			Sign lower = polynomial.sgn(interval.lower());
+			Sign upper = polynomial.sgn(interval.upper());
+			if (lower != Sign::ZERO && upper != Sign::ZERO && lower != upper) {
+				return polynomial.sgn(pivot) != lower;
+			}
+			return Polynomial::countRealRoots(getSturmSequence(), Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0;
+		}
+
+		/// Bisects the interval at some sample point.
+		void bisect() {
 			Number pivot = interval.sample();
 			assert(interval.contains(pivot));
 			if (polynomial.isRoot(pivot)) {
 				interval = Interval<Number>(pivot, pivot);
 			} else {
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+				if (rootBelow(pivot)) {
 					interval.setUpper(pivot);
 				} else {
 					interval.setLower(pivot);
 				}
 				refinementCount++;
+				Refinement::getInstance().bisections++;
 				assert(interval.isConsistent());
 			}
 		}
+
+		/**
+		 * Performs a step of the quadratic interval refinement @cite Abbott06 .
+		 * The interval is split into \f$N = 2^{qirExponent}\f$ parts and the secant through the bounds is used to guess the part containing the root.
+		 * If the guess is correct, the interval shrinks to this part and \f$N\f$ is squared. Otherwise, \f$N\f$ is reduced to its square root.
+		 * Requires the polynomial to change its sign on the interval.
+		 * @return If the interval was refined.
+		 */
+		bool refineQuadratic() {
+			Number lowerValue = polynomial.evaluate(interval.lower());
+			Number upperValue = polynomial.evaluate(interval.upper());
+			Sign lowerSign = carl::sgn(lowerValue);
+			if (lowerSign == Sign::ZERO || carl::sgn(upperValue) == Sign::ZERO || lowerSign == carl::sgn(upperValue)) return false;
+			if (qirExponent < 2) {
+				// With two parts, the secant step is a bisection.
+				qirExponent = 2;
+				return false;
+			}
+			Number parts = carl::pow(Number(2), qirExponent);
+			Number width = interval.diameter() / parts;
+			Number index = carl::floor(parts * lowerValue / (lowerValue - upperValue) + Number(1) / 2);
+			Number guess = interval.lower() + index * width;
+			Sign guessSign = polynomial.sgn(guess);
+			if (guessSign == Sign::ZERO) {
+				interval = Interval<Number>(guess, guess);
+				return true;
+			}
+			Number other = (guessSign == lowerSign) ? Number(guess + width) : Number(guess - width);
+			Sign otherSign = polynomial.sgn(other);
+			if (otherSign == Sign::ZERO) {
+				interval = Interval<Number>(other, other);
+				return true;
+			}
+			if (otherSign == guessSign) {
+				qirExponent /= 2;
+				Refinement::getInstance().failedSecantSteps++;
+				return false;
+			}
+			if (guess < other) {
+				interval = Interval<Number>(guess, BoundType::STRICT, other, BoundType::STRICT);
+			} else {
+				interval = Interval<Number>(other, BoundType::STRICT, guess, BoundType::STRICT);
+			}
+			qirExponent *= 2;
+			refinementCount++;
+			Refinement::getInstance().secantSteps++;
+			return true;
+		}
+
+		/// Refines the interval using the given strategy, falling back to bisection if a secant step fails.
+		void refine(RealAlgebraicNumberSettings::RefinementStrategy strategy = RealAlgebraicNumberSettings::RefinementStrategy::DEFAULT) {
+			if (strategy == RealAlgebraicNumberSettings::RefinementStrategy::QIR) {
+				if (refineQuadratic()) return;
+			}
+			bisect();
+		}
 			
 		/** Refine the interval i of this real algebraic number yielding the interval j such that !j.meets(n). If true is returned, n is the exact numeric representation of this root. Otherwise not.
 		 * @param n
@@ -99,7 +210,7 @@ namespace ran {
 					interval = Interval<Number>(n, n);
 					return true;
 				}
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+				if (rootBelow(n)) {
 					interval.setUpper(n);
 				} else {
 					interval.setLower(n);
@@ -111,41 +222,28 @@ namespace ran {
 			
 			bool isLeft = interval.lower() == n;
 			
-			Number newBound = interval.sample();
-			
-			if (polynomial.isRoot(newBound)) {
-				interval = Interval<Number>(newBound, newBound);
-				return false;
-			}
-			
-			if (isLeft) {
-				interval.setLower(newBound);
-			} else {
-				interval.setUpper(newBound);
-			}
-			
-			while (polynomial.countRealRoots(interval) == 0) {
-				if (isLeft) {
-					Number oldBound = interval.lower();
-					newBound = Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT).sample();
-					if (polynomial.isRoot(newBound)) {
-						interval = Interval<Number>(newBound, newBound);
-						return false;
-					}
-					interval.setUpper(oldBound);
+			// Move the bound n towards the root until a new bound is found that does not cut off the root.
+			while (true) {
+				Number newBound = interval.sample();
+				if (polynomial.isRoot(newBound)) {
+					interval = Interval<Number>(newBound, newBound);
+					return false;
+				}
+				bool below = rootBelow(newBound);
+				if (isLeft && !below) {
 					interval.setLower(newBound);
-				} else {
-					Number oldBound = interval.upper();
-					newBound = Interval<Number>(oldBound, BoundType::STRICT, n, BoundType::STRICT).sample();
-					if (polynomial.isRoot(newBound)) {
-						interval = Interval<Number>(newBound, newBound);
-						return false;
-					}
-					interval.setLower(oldBound);
+					return false;
+				}
+				if (!isLeft && below) {
 					interval.setUpper(newBound);
+					return false;
+				}
+				if (isLeft) {
+					interval.setUpper(newBound);
+				} else {
+					interval.setLower(newBound);
 				}
 			}
-			return false;
 		}
 		
 		void refineToIntegrality() {
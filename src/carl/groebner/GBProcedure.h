@@ -170,6 +170,16 @@ public:
 	}
 	
 	
+	/**
+	 * Sets the number of threads the procedure uses to reduce critical pairs, 1 disables the parallel reduction.
+	 * Only available for procedures based on Buchberger, F4 ignores it.
+	 * @param threads Number of threads.
+	 */
+	void setThreads(std::size_t threads)
+	{
+		Procedure<Polynomial, AddingPolynomialPolicy>::setThreads(threads);
+	}
+
 	/**
 	 * Remove all polynomials from the Groebner basis.
      */
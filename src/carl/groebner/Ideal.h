@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "ideal-ds/IdealDSTrie.h"
 #include "ideal-ds/IdealDSVector.h"
 #include "ideal-ds/PolynomialSorts.h"
 
@@ -18,8 +19,10 @@ namespace carl
 
 /**
  * @ingroup gb
+ * The lookup of divisors for the reduction is done by the given datastructure,
+ * i.e. IdealDatastructureTrie (the default) or IdealDatastructureVector.
  */
-template <class Polynomial, template<class> class Datastructure = IdealDatastructureVector, int CacheSize = 0>
+template <class Polynomial, template<class> class Datastructure = IdealDatastructureTrie, int CacheSize = 0>
 class Ideal
 {
 private:
@@ -139,6 +142,7 @@ public:
         }
         tempGen.swap(mGenerators);
         mEliminated.clear();
+        mDivisorLookup.reset();
 
     }
 	
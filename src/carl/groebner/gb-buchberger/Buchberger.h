@@ -34,10 +34,13 @@
 #include "../GBUpdateProcedures.h"
 #include "../Ideal.h"
 #include "../Reductor.h"
+#include "BuchbergerStats.h"
 #include "CriticalPairs.h"
 
+#include <cassert>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 namespace carl
 {
@@ -76,6 +79,9 @@ struct DefaultBuchbergerSettings
 /**
  * Gebauer and Moeller style implementation of the Buchberger algorithm. For more information about this Algorithm.
  * More information can be found in the Bachelor Thesis On Groebner Bases in SMT-Compliant Decision Procedures. 
+ *
+ * If more than one thread is set, all critical pairs whose lcm has minimal degree are reduced concurrently
+ * against a snapshot of the current basis, see reduceBatch().
  * @ingroup gb
  */
 template<typename Polynomial, template<typename> class AddingPolicy>
@@ -87,6 +93,8 @@ protected:
 	std::vector<size_t> mGbElementsIndices;
     std::shared_ptr<CritPairs> pCritPairs;
 	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
+	/// Number of threads used to reduce critical pairs, 1 disables the parallel reduction.
+	std::size_t mThreads;
 #ifdef BUCHBERGER_STATISTICS
 	BuchbergerStats* mStats;
 #endif
@@ -97,7 +105,8 @@ public:
 		pGb(),
 		mGbElementsIndices(),
 	    pCritPairs(new CritPairs()),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mThreads(1)
 	{
 		
 	}
@@ -108,7 +117,8 @@ public:
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
 		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mThreads(rhs.mThreads)
 	{
 	}
 	
@@ -121,6 +131,11 @@ public:
 	{
 		pCritPairs = criticalPairs;
 	}
+	void setThreads(std::size_t threads)
+	{
+		assert(threads > 0);
+		mThreads = threads;
+	}
 
 	//std::list<std::pair<BitVector, BitVector> > reduceInput();
 
@@ -133,6 +148,13 @@ protected:
 		 return AddingPolicy<Polynomial>::addToGb( newPol, pGb, &mUpdateCallBack);
 	}
 	void removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist);
+	/**
+	 * Reduces the S-polynomials of the given critical pairs using the given number of threads and adds the remainders to the basis.
+	 * @param pairs Critical pairs, the remainders are added in this order.
+	 * @param threads Number of threads.
+	 * @return If a constant polynomial was added.
+	 */
+	bool reduceBatch(const std::vector<SPolPair>& pairs, std::size_t threads);
 
 	void reduce();
 };
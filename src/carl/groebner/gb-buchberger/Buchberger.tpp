@@ -28,6 +28,11 @@
 #include "Buchberger.h"
 
 #include "../../core/polynomialfunctions/SPolynomial.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 //
 //
 namespace carl
@@ -57,8 +62,33 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	}
 
 
+	std::size_t threads = mThreads;
+#ifndef THREAD_SAFE
+	if(threads > 1)
+	{
+		CARL_LOG_WARN("carl.gb.buchberger", "Parallel reduction requires THREAD_SAFE, falling back to a single thread.");
+		threads = 1;
+	}
+#endif
+
+	if(!foundGB && threads > 1)
+	{
+		while(!pCritPairs->empty())
+		{
+			// Select all pairs of minimal degree.
+			// The pairs are ordered by CritPairs::Order, independent of Polynomial::OrderedBy. As it is a graded order, these are the first pairs.
+			static_assert(CritPairs::Order::degreeOrder, "The pairs of minimal degree are only the first pairs for a graded order.");
+			std::vector<SPolPair> pairs;
+			uint degree = pCritPairs->top().mLcm->tdeg();
+			while(!pCritPairs->empty() && pCritPairs->top().mLcm->tdeg() == degree)
+			{
+				pairs.push_back(pCritPairs->pop());
+			}
+			if(reduceBatch(pairs, threads)) break;
+		}
+	}
 	//As long as unprocessed pairs exist..
-	if(!foundGB)
+	else if(!foundGB)
 	{
 		while(!pCritPairs->empty())
 		{
@@ -102,7 +132,73 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 }
 
 
-//
+/**
+ * The S-polynomials are reduced against a snapshot of the basis which is taken before the reduction starts.
+ * As the snapshot contains no eliminated generators, looking up divisors does not modify it, hence it is shared among the threads.
+ * Afterwards, the nonzero remainders are added sequentially in the order of their leading terms,
+ * each of them being reduced once more by the basis including the remainders added before.
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+bool Buchberger<Polynomial, AddingPolicy>::reduceBatch(const std::vector<SPolPair>& pairs, std::size_t threads)
+{
+	const std::vector<Polynomial>& generators = pGb->getGenerators();
+	// Terms are ordered lazily, hence we order all polynomials before they are shared among the threads.
+	for(const Polynomial& g : generators) g.makeOrdered();
+	const Ideal<Polynomial> snapshot(*pGb);
+
+	std::vector<Polynomial> remainders(pairs.size());
+	threads = std::max(std::size_t(1), std::min(threads, pairs.size()));
+	std::vector<BuchbergerStats::WorkerStatistics> statistics(threads);
+	std::atomic<std::size_t> next(0);
+	auto worker = [&](std::size_t thread) {
+		auto start = std::chrono::steady_clock::now();
+		while(true)
+		{
+			std::size_t id = next++;
+			if(id >= pairs.size()) break;
+			const Polynomial& p1 = generators[pairs[id].mP1];
+			const Polynomial& p2 = generators[pairs[id].mP2];
+			Polynomial spol = carl::SPolynomial(p1, p2);
+			spol.setReasons(p1.getReasons() | p2.getReasons());
+			Reductor<Polynomial, Polynomial> reductor(snapshot, spol);
+			remainders[id] = reductor.fullReduce();
+			statistics[thread].reductions++;
+		}
+		statistics[thread].time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	};
+	CARL_LOG_DEBUG("carl.gb.buchberger", "Reducing " << pairs.size() << " pairs using " << threads << " threads");
+	std::vector<std::thread> pool;
+	for(std::size_t t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+	worker(0);
+	for(auto& t : pool) t.join();
+	BuchbergerStats::getInstance()->addWorkerStatistics(statistics);
+
+	std::vector<std::size_t> order;
+	for(std::size_t id = 0; id < remainders.size(); ++id)
+	{
+		if(!remainders[id].isZero()) order.push_back(id);
+	}
+	// Smaller leading terms first, such that they reduce the remainders added later.
+	std::stable_sort(order.begin(), order.end(), [&remainders](std::size_t lhs, std::size_t rhs){
+		return Polynomial::compareByLeadingTerm(remainders[lhs], remainders[rhs]);
+	});
+	for(std::size_t id : order)
+	{
+		Reductor<Polynomial, Polynomial> reductor(*pGb, remainders[id]);
+		Polynomial remainder = reductor.fullReduce();
+		CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << remainder);
+		if(remainder.isZero()) continue;
+		if(remainder.isConstant())
+		{
+			pGb->clear();
+			pGb->addGenerator(remainder.normalize());
+			return true;
+		}
+		if(addToGb(remainder.normalize())) return true;
+	}
+	return false;
+}
+
 /**
  * Updating the critical pairs based on the added generator.
  * @param index
@@ -28,6 +28,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+#include <vector>
+
 namespace carl
 {
 
@@ -39,6 +43,17 @@ class BuchbergerStats
 public:
     static BuchbergerStats* getInstance( );
 
+    /**
+     * Statistics of a single thread of the parallel reduction of critical pairs.
+     */
+    struct WorkerStatistics
+    {
+        /// number of S-polynomials reduced
+        std::size_t reductions = 0;
+        /// time spent reducing
+        std::chrono::microseconds time = std::chrono::microseconds( 0 );
+    };
+
     /**
      *  Count that we found a TSQ which had a constant trailing term
      */
@@ -102,6 +117,35 @@ public:
     {
         return mNrOfReducibleIdentities;
     }
+
+    /**
+     * Adds the statistics of the threads of a parallel reduction, the i-th entry is accumulated for the i-th thread.
+     */
+    void addWorkerStatistics( const std::vector<WorkerStatistics>& workers )
+    {
+        std::lock_guard<std::mutex> lock( mWorkerMutex );
+        if( mWorkers.size( ) < workers.size( ) ) mWorkers.resize( workers.size( ) );
+        for( std::size_t i = 0; i < workers.size( ); ++i )
+        {
+            mWorkers[i].reductions += workers[i].reductions;
+            mWorkers[i].time += workers[i].time;
+        }
+    }
+
+    /**
+     * @return The accumulated statistics of every thread of the parallel reductions.
+     */
+    std::vector<WorkerStatistics> getWorkerStatistics( ) const
+    {
+        std::lock_guard<std::mutex> lock( mWorkerMutex );
+        return mWorkers;
+    }
+
+    void resetWorkerStatistics( )
+    {
+        std::lock_guard<std::mutex> lock( mWorkerMutex );
+        mWorkers.clear( );
+    }
 protected:
 
     BuchbergerStats( ) :
@@ -110,7 +154,9 @@ protected:
     mNrOfSingleTermSFP( 0 ),
     mNrOfReducibleIdentities( 0 ),
     mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    mNrOfNonZeroReductions( 0 ),
+    mWorkers( ),
+    mWorkerMutex( )
     {
     }
     unsigned mNrOfTSQWithConstant;
@@ -119,6 +165,8 @@ protected:
     unsigned mNrOfReducibleIdentities;
     unsigned mNrOfReductions;
     unsigned mNrOfNonZeroReductions;
+    std::vector<WorkerStatistics> mWorkers;
+    mutable std::mutex mWorkerMutex;
 
 private:
     static BuchbergerStats* instance;
@@ -72,6 +72,8 @@ template<template <class> class Datastructure, class Configuration>
 class CriticalPairs
 {
 public:
+    /// The monomial ordering on the lcms of the pairs, which determines the order in which the pairs are popped.
+    using Order = typename Configuration::Order;
 
     CriticalPairs( ) : mDatastruct( Configuration( ) )
     {
@@ -93,6 +95,14 @@ public:
      * @return 
      */
     SPolPair pop( );
+	/**
+	 * Gets the first SPol from the data structure without removing it.
+     * @return 
+     */
+    const SPolPair& top( ) const
+    {
+        return mDatastruct.top( )->getFirst( );
+    }
 	/**
 	 * Eliminate multiples of the given monomial.
      * @param lm
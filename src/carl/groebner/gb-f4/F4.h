@@ -0,0 +1,49 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+#include "F4Matrix.h"
+
+#include <list>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Faugere's F4 algorithm @cite Faugere99.
+ * Instead of reducing one S-polynomial at a time, all critical pairs whose lcm has minimal degree are selected at once (the normal strategy).
+ * The multiples of the basis elements that are needed for these pairs and for reducing them are collected in a sparse Macaulay matrix which is then row reduced, see f4::Matrix.
+ * Coefficients from prime fields are reduced as machine integers.
+ *
+ * The management of critical pairs including the Gebauer and Moeller criteria is shared with Buchberger,
+ * hence F4 can be used as a drop-in replacement via GBProcedure.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+private:
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Matrix = f4::Matrix<Coeff>;
+public:
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+private:
+	/**
+	 * Reduces the given critical pairs simultaneously and adds the new polynomials to the basis.
+	 * @param pairs Critical pairs of the same degree.
+	 * @return If a constant polynomial was added.
+	 */
+	bool reducePairs(const std::vector<SPolPair>& pairs);
+	/// Returns m / d, where d must divide m.
+	static Monomial::Arg quotient(const Monomial::Arg& m, const Monomial::Arg& d);
+};
+
+}
+
+#include "F4.tpp"
@@ -0,0 +1,197 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		// Select all pairs of minimal degree.
+		// The pairs are ordered by CritPairs::Order, independent of Polynomial::OrderedBy. As it is a graded order, these are the first pairs.
+		static_assert(CritPairs::Order::degreeOrder, "The pairs of minimal degree are only the first pairs for a graded order.");
+		std::vector<SPolPair> pairs;
+		uint degree = this->pCritPairs->top().mLcm->tdeg();
+		while(!this->pCritPairs->empty() && this->pCritPairs->top().mLcm->tdeg() == degree)
+		{
+			pairs.push_back(this->pCritPairs->pop());
+		}
+		CARL_LOG_DEBUG("carl.gb.f4", "Selected " << pairs.size() << " pairs of degree " << degree);
+		foundGB = reducePairs(pairs);
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F4<Polynomial, AddingPolicy>::reducePairs(const std::vector<SPolPair>& pairs)
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+
+	// Symbolic preprocessing: monomials are identified by the order of their first occurrence,
+	// rows are stored as a generator and the identifiers of the monomials of its multiple.
+	struct SymbolicRow
+	{
+		std::size_t generator;
+		std::vector<std::size_t> monomials;
+	};
+	std::unordered_map<Monomial::Arg, std::size_t> ids;
+	std::vector<Monomial::Arg> monomials;
+	std::vector<bool> hasReducer;
+	auto makeRow = [&](std::size_t generator, const Monomial::Arg& m)
+	{
+		const Polynomial& g = generators[generator];
+		Monomial::Arg multiplier = quotient(m, g.lmon());
+		g.makeOrdered();
+		SymbolicRow row{generator, {}};
+		row.monomials.reserve(g.nrTerms());
+		for(auto it = g.rbegin(); it != g.rend(); ++it)
+		{
+			auto res = ids.emplace(it->monomial() * multiplier, monomials.size());
+			if(res.second)
+			{
+				monomials.push_back(res.first->first);
+				hasReducer.push_back(false);
+			}
+			row.monomials.push_back(res.first->second);
+		}
+		return row;
+	};
+
+	std::vector<SymbolicRow> reducers;
+	std::vector<SymbolicRow> rows;
+	// For every lcm, the first multiple becomes a reducer and all others are reduced.
+	std::vector<std::pair<Monomial::Arg, std::vector<std::size_t>>> lcms;
+	std::unordered_map<Monomial::Arg, std::size_t> lcmIndices;
+	for(const SPolPair& pair : pairs)
+	{
+		auto res = lcmIndices.emplace(pair.mLcm, lcms.size());
+		if(res.second) lcms.emplace_back(pair.mLcm, std::vector<std::size_t>());
+		std::vector<std::size_t>& gens = lcms[res.first->second].second;
+		for(std::size_t gen : {pair.mP1, pair.mP2})
+		{
+			if(std::find(gens.begin(), gens.end(), gen) == gens.end()) gens.push_back(gen);
+		}
+	}
+	for(const auto& lcm : lcms)
+	{
+		for(std::size_t gen : lcm.second)
+		{
+			SymbolicRow row = makeRow(gen, lcm.first);
+			if(hasReducer[row.monomials.front()])
+			{
+				rows.push_back(std::move(row));
+			}
+			else
+			{
+				hasReducer[row.monomials.front()] = true;
+				reducers.push_back(std::move(row));
+			}
+		}
+	}
+	// Add reducers for all monomials that are divisible by some leading monomial, the rows may add new monomials.
+	for(std::size_t i = 0; i < monomials.size(); ++i)
+	{
+		if(hasReducer[i] || !monomials[i]) continue;
+		std::size_t best = generators.size();
+		for(std::size_t index : this->mGbElementsIndices)
+		{
+			if(!monomials[i]->divisible(generators[index].lmon())) continue;
+			if(best == generators.size() || generators[index].nrTerms() < generators[best].nrTerms()) best = index;
+		}
+		if(best == generators.size()) continue;
+		hasReducer[i] = true;
+		Monomial::Arg m = monomials[i];
+		reducers.push_back(makeRow(best, m));
+	}
+
+	// Columns are the monomials in descending order.
+	std::vector<std::size_t> order(monomials.size());
+	for(std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+	std::sort(order.begin(), order.end(), [&monomials](std::size_t lhs, std::size_t rhs){
+		return Polynomial::OrderedBy::less(monomials[rhs], monomials[lhs]);
+	});
+	std::vector<std::size_t> columns(monomials.size());
+	for(std::size_t c = 0; c < order.size(); ++c) columns[order[c]] = c;
+	CARL_LOG_DEBUG("carl.gb.f4", "Matrix with " << reducers.size() << " reducers, " << rows.size() << " rows and " << monomials.size() << " columns");
+
+	Matrix matrix(typename Matrix::FieldType(generators[pairs.front().mP1].lcoeff()), monomials.size());
+	auto toRow = [&](const SymbolicRow& sr)
+	{
+		const Polynomial& g = generators[sr.generator];
+		typename Matrix::Row row;
+		row.columns.reserve(sr.monomials.size());
+		row.values.reserve(sr.monomials.size());
+		std::size_t k = 0;
+		for(auto it = g.rbegin(); it != g.rend(); ++it, ++k)
+		{
+			row.columns.push_back(columns[sr.monomials[k]]);
+			row.values.push_back(matrix.field().fromCoeff(it->coeff()));
+		}
+		row.reasons = g.getReasons();
+		return row;
+	};
+	for(const SymbolicRow& sr : reducers) matrix.addPivot(toRow(sr));
+	for(const SymbolicRow& sr : rows) matrix.addRow(toRow(sr));
+
+	std::vector<typename Matrix::Row> reduced = matrix.reduce();
+	// Larger leading monomials first, such that elements that become redundant are eliminated by the later ones.
+	std::sort(reduced.begin(), reduced.end(), [](const typename Matrix::Row& lhs, const typename Matrix::Row& rhs){
+		return lhs.columns.front() < rhs.columns.front();
+	});
+	for(const auto& row : reduced)
+	{
+		typename Polynomial::TermsType terms;
+		terms.reserve(row.columns.size());
+		for(std::size_t k = row.columns.size(); k > 0; --k)
+		{
+			terms.emplace_back(matrix.field().toCoeff(row.values[k-1]), monomials[order[row.columns[k-1]]]);
+		}
+		Polynomial p(std::move(terms), false, true);
+		p.setReasons(row.reasons);
+		CARL_LOG_DEBUG("carl.gb.f4", "New basis element: " << p);
+		if(this->addToGb(p)) return true;
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Monomial::Arg F4<Polynomial, AddingPolicy>::quotient(const Monomial::Arg& m, const Monomial::Arg& d)
+{
+	Monomial::Arg res;
+	if(m == d) return res;
+	bool divisible = m->divide(d, res);
+	assert(divisible);
+	(void)divisible;
+	return res;
+}
+
+}
@@ -0,0 +1,264 @@
+/**
+ * @file F4Matrix.h
+ * @ingroup gb
+ *
+ * Sparse Macaulay matrices as used by the F4 algorithm.
+ */
+
+#pragma once
+
+#include "../../numbers/numbers.h"
+#include "../../util/BitVector.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace carl
+{
+namespace f4
+{
+
+/**
+ * Arithmetic on the matrix entries.
+ * By default, the coefficients of the polynomials are stored as they are.
+ * @ingroup gb
+ */
+template<typename Coeff>
+struct Field
+{
+	using Element = Coeff;
+
+	explicit Field(const Coeff&) {}
+
+	Element fromCoeff(const Coeff& c) const
+	{
+		return c;
+	}
+	Coeff toCoeff(const Element& e) const
+	{
+		return e;
+	}
+	Element zero() const
+	{
+		return Element(0);
+	}
+	bool isZero(const Element& e) const
+	{
+		return carl::isZero(e);
+	}
+	Element inverse(const Element& e) const
+	{
+		return Element(1) / e;
+	}
+	/// a *= f
+	void mul(Element& a, const Element& f) const
+	{
+		a *= f;
+	}
+	/// a -= f * b
+	void subMul(Element& a, const Element& f, const Element& b) const
+	{
+		a -= f * b;
+	}
+};
+
+/**
+ * Arithmetic on the matrix entries for prime fields.
+ * The entries are stored as machine integers in [0, p), which is considerably faster than working on GFNumber objects.
+ * Only prime fields Z_p with a word-size p are supported.
+ * @ingroup gb
+ */
+template<typename Integer>
+struct Field<GFNumber<Integer>>
+{
+	using Element = std::uint64_t;
+	const GaloisField<Integer>* mGf;
+	Element mP;
+
+	static Element toElement(const mpz_class& n)
+	{
+		return Element(carl::toInt<carl::uint>(n));
+	}
+	static Element toElement(sint n)
+	{
+		return Element(n);
+	}
+
+	explicit Field(const GFNumber<Integer>& c): mGf(c.gf()), mP(0)
+	{
+		assert(mGf != nullptr);
+		assert(mGf->k() == 1);
+		mP = mGf->p();
+		// subMul() and inverse() multiply two entries in a single word.
+		assert(mP < (Element(1) << 32));
+	}
+
+	Element fromCoeff(const GFNumber<Integer>& c) const
+	{
+		Integer r = carl::mod(Integer(c.representingInteger()), Integer(mP));
+		if (r < 0) r += Integer(mP);
+		return toElement(r);
+	}
+	GFNumber<Integer> toCoeff(const Element& e) const
+	{
+		return GFNumber<Integer>(Integer(carl::uint(e)), mGf);
+	}
+	Element zero() const
+	{
+		return 0;
+	}
+	bool isZero(const Element& e) const
+	{
+		return e == 0;
+	}
+	Element inverse(const Element& e) const
+	{
+		assert(e != 0);
+		// Fermat: e^(p-2)
+		Element res = 1;
+		Element base = e;
+		for (Element exp = mP - 2; exp > 0; exp >>= 1) {
+			if (exp & 1) res = res * base % mP;
+			base = base * base % mP;
+		}
+		return res;
+	}
+	void mul(Element& a, const Element& f) const
+	{
+		a = a * f % mP;
+	}
+	/// Both factors are below p < 2^32, hence the product fits into a word.
+	void subMul(Element& a, const Element& f, const Element& b) const
+	{
+		a += f * (mP - b) % mP;
+		if (a >= mP) a -= mP;
+	}
+};
+
+/**
+ * A sparse matrix whose columns correspond to monomials in descending order.
+ * The matrix consists of pivot rows with pairwise different leading columns and of rows that are reduced by the pivot rows.
+ * Every row is stored as two separate arrays of column indices and values, the reduction scatters one row into a dense accumulator, eliminates all columns that have a pivot and gathers the remaining entries.
+ * Every reduced row that is not zero becomes a new pivot, hence the reduced rows form a matrix in echelon form.
+ * @ingroup gb
+ */
+template<typename Coeff>
+class Matrix
+{
+public:
+	using FieldType = Field<Coeff>;
+	using Element = typename FieldType::Element;
+
+	struct Row
+	{
+		/// Column indices in ascending order.
+		std::vector<std::size_t> columns;
+		std::vector<Element> values;
+		/// The reasons of all rows this row was computed from.
+		BitVector reasons;
+	};
+private:
+	static constexpr std::size_t NoPivot = std::numeric_limits<std::size_t>::max();
+
+	FieldType mField;
+	std::size_t mColumns;
+	std::vector<Row> mPivots;
+	/// Maps a column to the pivot row with this leading column.
+	std::vector<std::size_t> mPivotOf;
+	std::vector<Row> mRows;
+
+	void makeMonic(Row& r) const
+	{
+		assert(!r.values.empty());
+		if (r.values.front() == Element(1)) return;
+		Element inv = mField.inverse(r.values.front());
+		for (auto& v: r.values) mField.mul(v, inv);
+	}
+public:
+	Matrix(const FieldType& field, std::size_t columns):
+		mField(field), mColumns(columns), mPivots(), mPivotOf(columns, NoPivot), mRows()
+	{}
+
+	const FieldType& field() const
+	{
+		return mField;
+	}
+	std::size_t nrColumns() const
+	{
+		return mColumns;
+	}
+	std::size_t nrRows() const
+	{
+		return mPivots.size() + mRows.size();
+	}
+	bool hasPivot(std::size_t column) const
+	{
+		return mPivotOf[column] != NoPivot;
+	}
+
+	/**
+	 * Adds a pivot row, the leading column must not have a pivot yet.
+	 */
+	void addPivot(Row&& r)
+	{
+		assert(!r.columns.empty());
+		assert(!hasPivot(r.columns.front()));
+		makeMonic(r);
+		mPivotOf[r.columns.front()] = mPivots.size();
+		mPivots.push_back(std::move(r));
+	}
+	/**
+	 * Adds a row that is reduced by the pivot rows.
+	 */
+	void addRow(Row&& r)
+	{
+		assert(!r.columns.empty());
+		mRows.push_back(std::move(r));
+	}
+
+	/**
+	 * Reduces all rows by the pivot rows and by the previously reduced rows.
+	 * @return The nonzero reduced rows, each of them is monic and has a leading column without any pivot before.
+	 */
+	std::vector<Row> reduce()
+	{
+		std::vector<Row> result;
+		std::vector<Element> dense(mColumns, mField.zero());
+		for (Row& row: mRows) {
+			std::size_t first = row.columns.front();
+			for (std::size_t k = 0; k < row.columns.size(); k++) {
+				dense[row.columns[k]] = row.values[k];
+			}
+			BitVector reasons = row.reasons;
+			for (std::size_t c = first; c < mColumns; c++) {
+				if (mField.isZero(dense[c]) || mPivotOf[c] == NoPivot) continue;
+				const Row& pivot = mPivots[mPivotOf[c]];
+				Element f = dense[c];
+				for (std::size_t k = 0; k < pivot.columns.size(); k++) {
+					mField.subMul(dense[pivot.columns[k]], f, pivot.values[k]);
+				}
+				assert(mField.isZero(dense[c]));
+				reasons |= pivot.reasons;
+			}
+			Row reduced;
+			for (std::size_t c = first; c < mColumns; c++) {
+				if (mField.isZero(dense[c])) continue;
+				reduced.columns.push_back(c);
+				reduced.values.push_back(dense[c]);
+				dense[c] = mField.zero();
+			}
+			if (reduced.columns.empty()) continue;
+			reduced.reasons = reasons;
+			makeMonic(reduced);
+			result.push_back(reduced);
+			addPivot(std::move(reduced));
+		}
+		mRows.clear();
+		return result;
+	}
+};
+
+}
+}
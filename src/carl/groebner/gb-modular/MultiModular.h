@@ -0,0 +1,339 @@
+/**
+ * @file   MultiModular.h
+ * @ingroup gb
+ *
+ * Multi-modular computation of Groebner bases over the rationals @cite Arnold03.
+ * The reduced Groebner basis is computed modulo several primes, the images are combined using the chinese remainder theorem and rational reconstruction.
+ * Primes whose images have different leading monomials than the majority of the images are considered unlucky and are discarded.
+ * The reconstructed basis is verified over the rationals before it is returned.
+ * This verification is only a proof for homogeneous input, hence other input is left to the caller.
+ */
+
+#pragma once
+
+#include "../gb-f4/F4.h"
+#include "../GBProcedure.h"
+#include "../../core/polynomialfunctions/SPolynomial.h"
+#include "../../numbers/GFNumber.h"
+#include "../../numbers/PrimeFactory.h"
+#include "../../util/SFINAE.h"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace carl
+{
+namespace modular_groebner
+{
+
+	/// The type of the primes, as used to identify the galois fields.
+	using Prime = GaloisField<sint>::BaseIntType;
+	/// Primes below this bound are skipped, as they are more likely to be unlucky.
+	static constexpr Prime MinimalPrime = 1u << 15;
+	/// Maximal number of primes before we give up and the caller falls back to a computation over the rationals.
+	static constexpr std::size_t MaximalPrimes = 500;
+
+	using GF = GFNumber<sint>;
+
+	/**
+	 * States if the modular algorithm is applicable for the given polynomial type.
+	 * This is the case for polynomials over rational numbers.
+	 */
+	template<typename Polynomial>
+	struct is_applicable: std::false_type {};
+	template<typename C, typename O, typename P>
+	struct is_applicable<MultivariatePolynomial<C,O,P>>: std::integral_constant<bool, is_rational<C>::value> {};
+
+	/**
+	 * The reduced Groebner basis modulo a single prime.
+	 * The basis is sorted by the leading monomials and every element is monic.
+	 */
+	struct Image
+	{
+		std::vector<Monomial::Arg> leading;
+		/// The terms of every basis element, the coefficients are taken from the symmetric range.
+		std::vector<std::vector<std::pair<Monomial::Arg, sint>>> polys;
+	};
+
+	/**
+	 * Checks whether all terms of the polynomial have the same total degree.
+	 */
+	template<typename Polynomial>
+	bool isHomogeneous(const Polynomial& p)
+	{
+		return std::all_of(p.begin(), p.end(), [&p](const typename Polynomial::TermType& t){ return t.tdeg() == p.begin()->tdeg(); });
+	}
+
+	/**
+	 * Scales the polynomials such that they have integral, coprime coefficients.
+	 */
+	template<typename Polynomial>
+	std::vector<Polynomial> integral(const std::vector<Polynomial>& polys)
+	{
+		using Number = typename Polynomial::CoeffType;
+		using Integer = typename IntegralType<Number>::type;
+		std::vector<Polynomial> res;
+		for (const auto& p: polys) {
+			if (p.isZero()) continue;
+			Integer num = constant_zero<Integer>::get();
+			Integer den = constant_one<Integer>::get();
+			for (const auto& t: p) {
+				num = carl::gcd(num, getNum(t.coeff()));
+				den = carl::lcm(den, getDenom(t.coeff()));
+			}
+			res.push_back(p * Number(Number(den) / Number(num)));
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the image of the reduced Groebner basis of the given integral polynomials modulo the given prime.
+	 * @return false, if the prime divides a leading coefficient.
+	 */
+	template<typename Polynomial>
+	bool image(const std::vector<Polynomial>& input, Prime prime, Image& res)
+	{
+		using Integer = typename IntegralType<typename Polynomial::CoeffType>::type;
+		using ModularPolynomial = MultivariatePolynomial<GF, typename Polynomial::OrderedBy>;
+		const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+		GBProcedure<ModularPolynomial, F4, StdAdding> gb;
+		for (const auto& p: input) {
+			p.makeOrdered();
+			typename ModularPolynomial::TermsType terms;
+			for (const auto& t: p) {
+				GF c(toInt<sint>(Integer(carl::mod(getNum(t.coeff()), Integer(prime)))), gf);
+				if (!c.isZero()) terms.emplace_back(c, t.monomial());
+			}
+			if (terms.empty() || !(terms.back().monomial() == p.lmon())) return false;
+			gb.addPolynomial(ModularPolynomial(std::move(terms), false, true));
+		}
+		gb.reduceInput();
+		gb.calculate();
+		std::vector<ModularPolynomial> basis = gb.getBasisPolynomials();
+		std::sort(basis.begin(), basis.end(), ModularPolynomial::compareByLeadingTerm);
+		res = Image();
+		for (const auto& b: basis) {
+			ModularPolynomial m = b.normalize();
+			res.leading.push_back(m.lmon());
+			res.polys.emplace_back();
+			for (const auto& t: m) {
+				res.polys.back().emplace_back(t.monomial(), GF(t.coeff().representingInteger(), gf).representingInteger());
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Reconstructs a fraction n/d from its image a modulo m, such that |n|, |d| <= sqrt(m/2).
+	 * @return false, if there is no such fraction.
+	 */
+	template<typename Integer, typename Number>
+	bool rationalReconstruction(const Integer& a, const Integer& m, Number& res)
+	{
+		// x <= sqrt(m/2) iff 2*x^2 <= m
+		auto small = [&m](const Integer& x){ return Integer(2) * x * x <= m; };
+		Integer r0 = m;
+		Integer r1 = carl::mod(a, m);
+		if (r1 < 0) r1 += m;
+		Integer s0 = constant_zero<Integer>::get();
+		Integer s1 = constant_one<Integer>::get();
+		while (!small(r1)) {
+			Integer q = carl::quotient(r0, r1);
+			Integer r = r0 - q * r1;
+			r0 = r1;
+			r1 = r;
+			Integer s = s0 - q * s1;
+			s0 = s1;
+			s1 = s;
+		}
+		if (!small(s1) || carl::gcd(r1, carl::abs(s1)) != 1) return false;
+		res = Number(r1) / Number(s1);
+		return true;
+	}
+
+	/**
+	 * Combines images with the same leading monomials using the chinese remainder theorem.
+	 */
+	template<typename Polynomial>
+	class Lifting
+	{
+		using Number = typename Polynomial::CoeffType;
+		using Integer = typename IntegralType<Number>::type;
+
+		std::vector<Monomial::Arg> mLeading;
+		/// The combined coefficients of every basis element, taken from the symmetric range.
+		std::vector<std::unordered_map<Monomial::Arg, Integer>> mCoefficients;
+		Integer mModulus = constant_one<Integer>::get();
+		std::size_t mPrimes = 0;
+		/// The basis reconstructed after the last prime.
+		std::vector<Polynomial> mLast;
+	public:
+		explicit Lifting(const Image& image): mLeading(image.leading), mCoefficients(image.leading.size()) {}
+
+		const std::vector<Monomial::Arg>& leading() const
+		{
+			return mLeading;
+		}
+		std::size_t primes() const
+		{
+			return mPrimes;
+		}
+
+		/**
+		 * Combines the current coefficients with the given image.
+		 */
+		void add(const Image& image, Prime prime)
+		{
+			assert(image.leading == mLeading);
+			Integer p(prime);
+			const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+			GF inverse = GF(toInt<sint>(Integer(carl::mod(mModulus, p))), gf).inverse();
+			for (std::size_t i = 0; i < mLeading.size(); i++) {
+				auto& coeffs = mCoefficients[i];
+				// Monomials missing in either side have a zero coefficient.
+				std::unordered_map<Monomial::Arg, sint> residues(image.polys[i].begin(), image.polys[i].end());
+				for (const auto& r: residues) coeffs.emplace(r.first, constant_zero<Integer>::get());
+				for (auto& c: coeffs) {
+					auto it = residues.find(c.first);
+					GF value(it == residues.end() ? 0 : it->second, gf);
+					GF old(toInt<sint>(Integer(carl::mod(c.second, p))), gf);
+					GF digit = (value - old) * inverse;
+					digit.normalize();
+					c.second += mModulus * Integer(digit.representingInteger());
+				}
+			}
+			mModulus *= p;
+			mPrimes++;
+		}
+
+		/**
+		 * Reconstructs the basis from the combined coefficients.
+		 * @return true, if all coefficients could be reconstructed and the result did not change since the last prime.
+		 */
+		bool reconstruct(std::vector<Polynomial>& res)
+		{
+			res.clear();
+			for (const auto& coeffs: mCoefficients) {
+				typename Polynomial::TermsType terms;
+				for (const auto& c: coeffs) {
+					if (isZero(c.second)) continue;
+					Number n;
+					if (!rationalReconstruction(c.second, mModulus, n)) {
+						mLast.clear();
+						return false;
+					}
+					terms.emplace_back(n, c.first);
+				}
+				res.emplace_back(std::move(terms), false, false);
+				res.back().makeOrdered();
+			}
+			bool stable = (res == mLast);
+			mLast = res;
+			return stable;
+		}
+	};
+
+	/**
+	 * Checks whether the given basis is a Groebner basis of an ideal that contains the input.
+	 * Every input polynomial must reduce to zero and all S-polynomials must reduce to zero.
+	 * If the input is homogeneous and the leading monomials of the basis are those of the basis modulo some prime, the basis is the Groebner basis of the input:
+	 * reducing modulo a prime does not increase the dimension of the ideal of the input in any degree, and the ideal of the basis has the same dimension in every degree.
+	 * For other input, this does not show that the basis elements are contained in the ideal of the input.
+	 */
+	template<typename Polynomial>
+	bool verify(const std::vector<Polynomial>& input, const std::vector<Polynomial>& basis)
+	{
+		Ideal<Polynomial> ideal;
+		for (const auto& b: basis) ideal.addGenerator(b);
+		for (const auto& p: input) {
+			Reductor<Polynomial, Polynomial> reductor(ideal, p);
+			if (!reductor.fullReduce().isZero()) return false;
+		}
+		for (std::size_t i = 0; i < basis.size(); i++) {
+			for (std::size_t j = i + 1; j < basis.size(); j++) {
+				// Buchbergers first criterion
+				if (Monomial::lcm(basis[i].lmon(), basis[j].lmon())->tdeg() == basis[i].lmon()->tdeg() + basis[j].lmon()->tdeg()) continue;
+				Reductor<Polynomial, Polynomial> reductor(ideal, carl::SPolynomial(basis[i], basis[j]));
+				if (!reductor.fullReduce().isZero()) return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Computes the reduced Groebner basis of the input using the multi-modular algorithm.
+	 * @return false, if the input is not homogeneous or no basis could be found with the maximal number of primes.
+	 */
+	template<typename Polynomial, EnableIf<is_applicable<Polynomial>> = dummy>
+	bool groebnerBasis(const std::vector<Polynomial>& polys, std::vector<Polynomial>& res)
+	{
+		std::vector<Polynomial> input = integral(polys);
+		if (input.empty()) return false;
+		for (const auto& p: input) {
+			if (p.isConstant()) return false;
+			if (!isHomogeneous(p)) {
+				CARL_LOG_DEBUG("carl.gb.modular", "Input " << p << " is not homogeneous, the result could not be verified.");
+				return false;
+			}
+		}
+		std::vector<Lifting<Polynomial>> liftings;
+		PrimeFactory<mpz_class> primes;
+		std::size_t used = 0;
+		while (used < MaximalPrimes) {
+			mpz_class next = primes.nextPrime();
+			if (next < MinimalPrime) continue;
+			assert(next <= std::numeric_limits<Prime>::max());
+			Prime prime = static_cast<Prime>(toInt<uint>(next));
+			used++;
+			Image img;
+			if (!image(input, prime, img)) {
+				CARL_LOG_DEBUG("carl.gb.modular", "Skipping prime " << prime << " as it divides a leading coefficient.");
+				continue;
+			}
+			auto it = std::find_if(liftings.begin(), liftings.end(), [&img](const Lifting<Polynomial>& l){ return l.leading() == img.leading; });
+			if (it == liftings.end()) {
+				CARL_LOG_DEBUG("carl.gb.modular", "Prime " << prime << " yields new leading monomials " << img.leading);
+				liftings.emplace_back(img);
+				it = liftings.end() - 1;
+			}
+			it->add(img, prime);
+			// Only the images with the most frequent leading monomials are considered lucky.
+			bool majority = std::all_of(liftings.begin(), liftings.end(), [&it](const Lifting<Polynomial>& l){ return l.primes() <= it->primes(); });
+			if (!majority) continue;
+			if (!it->reconstruct(res)) continue;
+			CARL_LOG_DEBUG("carl.gb.modular", "Verifying basis after " << it->primes() << " primes: " << res);
+			if (verify(input, res)) return true;
+		}
+		CARL_LOG_WARN("carl.gb.modular", "Failed to compute the basis with " << MaximalPrimes << " primes.");
+		return false;
+	}
+	template<typename Polynomial, DisableIf<is_applicable<Polynomial>> = dummy>
+	bool groebnerBasis(const std::vector<Polynomial>&, std::vector<Polynomial>&)
+	{
+		return false;
+	}
+}
+
+/**
+ * Computes Groebner bases over the rationals using the multi-modular algorithm, see modular_groebner.
+ * As the basis is computed from scratch, the incremental interface of GBProcedure is supported by computing the basis of the current basis together with the new polynomials.
+ * Every element of the result is attributed with the reasons of all input polynomials.
+ * Other adding policies than StdAdding change the ideal while computing the basis, hence they are handled by F4, as well as other coefficient types, non-homogeneous input and inputs where the modular algorithm fails.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class MultiModular : public F4<Polynomial, AddingPolicy>
+{
+private:
+	using Super = F4<Polynomial, AddingPolicy>;
+public:
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+};
+
+}
+
+#include "MultiModular.tpp"
@@ -0,0 +1,45 @@
+/**
+ * @file MultiModular.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "MultiModular.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void MultiModular<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.modular", "Calculate gb");
+	if(!std::is_same<AddingPolicy<Polynomial>, StdAdding<Polynomial>>::value)
+	{
+		Super::calculate(scheduledForAdding);
+		return;
+	}
+	std::vector<Polynomial> input(this->pGb->getGenerators());
+	input.insert(input.end(), scheduledForAdding.begin(), scheduledForAdding.end());
+	std::vector<Polynomial> basis;
+	if(!modular_groebner::groebnerBasis(input, basis))
+	{
+		CARL_LOG_INFO("carl.gb.modular", "Falling back to F4");
+		Super::calculate(scheduledForAdding);
+		return;
+	}
+	BitVector reasons;
+	for(const Polynomial& p : input)
+	{
+		reasons |= p.getReasons();
+	}
+	this->pGb->clear();
+	for(Polynomial& b : basis)
+	{
+		b.setReasons(reasons);
+		this->pGb->addGenerator(b);
+	}
+}
+
+}
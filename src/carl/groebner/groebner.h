@@ -9,4 +9,6 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
+#include "gb-f4/F4.h"
+#include "gb-modular/MultiModular.h"
 #include "Reductor.h"
\ No newline at end of file
@@ -0,0 +1,195 @@
+/**
+ * @file:   IdealDSTrie.h
+ * @ingroup gb
+ *
+ * A divisor lookup for ideals based on a monomial trie with divisibility masks.
+ */
+
+#pragma once
+
+#include "../../core/Term.h"
+#include "../../core/VariablePool.h"
+#include "../DivisionLookupResult.h"
+#include "PolynomialSorts.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Stores the leading monomials of the generators in a trie.
+ * Every edge is labelled with a variable and its exponent, the variables along a path are strictly increasing,
+ * hence every leading monomial corresponds to a path starting in the root.
+ * To find the divisors of a monomial, only edges whose variables occur in the monomial with at least the same exponent are followed,
+ * and subtrees are skipped altogether if their divisibility mask is not covered by the divisibility mask of the monomial.
+ *
+ * Eliminated generators are removed lazily when they are encountered during a lookup.
+ * As IdealDatastructureVector, the divisor with the smallest leading term is returned.
+ * @ingroup gb
+ */
+template<class Polynomial>
+class IdealDatastructureTrie
+{
+	using DivMask = std::uint64_t;
+	using Edge = std::pair<Variable, uint>;
+
+	struct Node
+	{
+		/// Maps an edge to the index of the child node.
+		std::map<Edge, std::size_t> children;
+		/// The generators whose leading monomial ends in this node.
+		std::vector<std::size_t> generators;
+		/// The intersection of the divisibility masks of all leading monomials in this subtree.
+		DivMask mask = ~DivMask(0);
+	};
+
+	static constexpr std::size_t NoDivisor = std::numeric_limits<std::size_t>::max();
+public:
+
+	IdealDatastructureTrie(const std::vector<Polynomial>& generators, const std::unordered_set<size_t>& eliminated, const sortByLeadingTerm<Polynomial>& order)
+	: mGenerators(generators), mEliminated(eliminated), mOrder(order), mNodes(1)
+	{
+	}
+
+	IdealDatastructureTrie(const IdealDatastructureTrie& id)
+	: mGenerators(id.mGenerators), mEliminated(id.mEliminated), mOrder(id.mOrder), mNodes(id.mNodes)
+	{
+	}
+
+	virtual ~IdealDatastructureTrie() = default;
+
+	/**
+	 * Should be called whenever an generator is added
+	 * @param fIndex
+	 */
+	void addGenerator(size_t fIndex) const
+	{
+		assert(!mGenerators[fIndex].isZero());
+		const Monomial::Arg& m = mGenerators[fIndex].lmon();
+		DivMask mask = divMask(m);
+		std::size_t node = 0;
+		mNodes[node].mask &= mask;
+		if (m) {
+			for (const Edge& e: *m) {
+				auto res = mNodes[node].children.emplace(e, mNodes.size());
+				std::size_t next = res.first->second;
+				if (res.second) mNodes.emplace_back();
+				node = next;
+				mNodes[node].mask &= mask;
+			}
+		}
+		mNodes[node].generators.push_back(fIndex);
+	}
+
+	/**
+	 *
+	 * @param t
+	 * @return A divisionresult [divisor, factor].
+	 */
+	DivisionLookupResult<Polynomial> getDivisor(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		std::size_t divisor = findDivisor(t.monomial());
+		if (divisor == NoDivisor) return DivisionLookupResult<Polynomial>();
+		Term<typename Polynomial::CoeffType> divres;
+		bool divisible = t.divide(mGenerators[divisor].lterm(), divres);
+		assert(divisible);
+		(void)divisible;
+		//To eliminate, we have to negate the factor.
+		divres.negate();
+		return DivisionLookupResult<Polynomial>(&mGenerators[divisor], divres);
+	}
+
+	bool isDividable(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		return findDivisor(t.monomial()) != NoDivisor;
+	}
+
+	/**
+	 * Should be called if the generator set is reset.
+	 */
+	void reset()
+	{
+		mNodes.assign(1, Node());
+		for (size_t i = 0; i < mGenerators.size(); ++i)
+		{
+			if (mEliminated.count(i) == 0) addGenerator(i);
+		}
+	}
+
+private:
+	/**
+	 * Computes a mask with two bits per variable (modulo 32 variables), which are set if the exponent is at least one and at least two, respectively.
+	 * If a monomial divides another one, its mask is a subset of the mask of the other one.
+	 */
+	static DivMask divMask(const Monomial::Arg& m)
+	{
+		DivMask mask = 0;
+		if (!m) return mask;
+		for (const Edge& e: *m)
+		{
+			std::size_t bit = 2 * (e.first.id() % (sizeof(DivMask) * 4));
+			mask |= DivMask(1) << bit;
+			if (e.second > 1) mask |= DivMask(1) << (bit + 1);
+		}
+		return mask;
+	}
+
+	std::size_t findDivisor(const Monomial::Arg& m) const
+	{
+		std::size_t best = NoDivisor;
+		search(0, m, 0, divMask(m), best);
+		return best;
+	}
+
+	/**
+	 * Searches the subtree of the given node for divisors of m.
+	 * @param node The current node.
+	 * @param m The monomial.
+	 * @param pos The first variable of m that may occur in the subtree.
+	 * @param mask The divisibility mask of m.
+	 * @param best The smallest divisor found so far.
+	 */
+	void search(std::size_t node, const Monomial::Arg& m, std::size_t pos, DivMask mask, std::size_t& best) const
+	{
+		Node& n = mNodes[node];
+		if ((n.mask & ~mask) != 0) return;
+		for (auto it = n.generators.begin(); it != n.generators.end();)
+		{
+			if (mEliminated.count(*it) == 1)
+			{
+				it = n.generators.erase(it);
+				continue;
+			}
+			if (best == NoDivisor || mOrder(*it, best)) best = *it;
+			++it;
+		}
+		if (!m || n.children.empty()) return;
+		for (std::size_t i = pos; i < m->nrVariables(); ++i)
+		{
+			const Edge& e = (*m)[i];
+			for (auto it = n.children.lower_bound(Edge(e.first, 0)); it != n.children.end() && it->first.first == e.first && it->first.second <= e.second; ++it)
+			{
+				search(it->second, m, i + 1, mask, best);
+			}
+		}
+	}
+
+	/// A reference to the generators in the ideal
+	const std::vector<Polynomial>& mGenerators;
+	/// A reference to the indices of eliminated generators
+	const std::unordered_set<size_t>& mEliminated;
+	/// A object which orders the generators according their leading terms, given their indices
+	const sortByLeadingTerm<Polynomial>& mOrder;
+	/// The nodes of the trie, the root is the first node.
+	// has to be mutable so we can remove eliminated generators found while looking for a divisor.
+	mutable std::vector<Node> mNodes;
+};
+
+}
@@ -79,11 +79,11 @@ private:
 	}
 	
 	IntegerType symmetricModulo(const IntegerType& n) const	{
-		if (n > mMaxValue) {
-			return carl::mod(IntegerType(n-mModulus), mPK) - mMaxValue;
-		} else {
-			return carl::mod(n, mPK);
-		}
+		// carl::mod truncates, hence the result has the sign of n.
+		IntegerType res = carl::mod(n, mPK);
+		if (res < -mMaxValue) res += mPK;
+		if (res > mMaxValue) res -= mPK;
+		return res;
 	}
 	
 	friend bool operator==(const GaloisField& lhs, const GaloisField& rhs) {
@@ -101,10 +101,16 @@ public:
 	using BaseIntType = typename GaloisField<IntegerType>::BaseIntType;
 private:
 	std::map<std::pair<BaseIntType,BaseIntType>, std::unique_ptr<GaloisField<IntegerType>>, IntegerPairCompare<unsigned>> mGaloisFields;
+#ifdef THREAD_SAFE
+	std::mutex mMutex;
+#endif
 public:
 	
 	const GaloisField<IntegerType>* getField(BaseIntType p, BaseIntType k = 1)
 	{
+#ifdef THREAD_SAFE
+		std::lock_guard<std::mutex> guard(mMutex);
+#endif
 		auto it = mGaloisFields.find(std::make_pair(p,k));
 		if (it == mGaloisFields.end()) {	
 			auto newit = mGaloisFields.emplace(
@@ -0,0 +1,596 @@
+/**
+ * @file   adaption_hybrid/HybridNumbers.h
+ * @ingroup hybrid
+ *
+ * Integer and rational number types that store small values inline as machine integers.
+ * Whenever an operation overflows, the value is promoted to the respective GMP type. Results that fit into machine
+ * integers again are demoted, hence every value has a unique representation.
+ * As opposed to Numeric, these types do not share any global state and can be used concurrently.
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../adaption_gmpxx/include.h"
+#include "../../util/SFINAE.h"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace carl {
+
+namespace hybrid {
+#if defined(__GNUC__) || defined(__clang__)
+	/// Adds two machine integers, returns false on overflow.
+	inline bool add(sint a, sint b, sint& res) {
+		return !__builtin_add_overflow(a, b, &res);
+	}
+	/// Subtracts two machine integers, returns false on overflow.
+	inline bool sub(sint a, sint b, sint& res) {
+		return !__builtin_sub_overflow(a, b, &res);
+	}
+	/// Multiplies two machine integers, returns false on overflow.
+	inline bool mul(sint a, sint b, sint& res) {
+		return !__builtin_mul_overflow(a, b, &res);
+	}
+#else
+	/// Adds two machine integers, returns false on overflow.
+	inline bool add(sint a, sint b, sint& res) {
+		if (b > 0 && a > std::numeric_limits<sint>::max() - b) return false;
+		if (b < 0 && a < std::numeric_limits<sint>::min() - b) return false;
+		res = a + b;
+		return true;
+	}
+	/// Subtracts two machine integers, returns false on overflow.
+	inline bool sub(sint a, sint b, sint& res) {
+		if (b < 0 && a > std::numeric_limits<sint>::max() + b) return false;
+		if (b > 0 && a < std::numeric_limits<sint>::min() + b) return false;
+		res = a - b;
+		return true;
+	}
+	/// Multiplies two machine integers, returns false on overflow.
+	inline bool mul(sint a, sint b, sint& res) {
+		constexpr sint max = std::numeric_limits<sint>::max();
+		constexpr sint min = std::numeric_limits<sint>::min();
+		if (a > 0) {
+			if (b > 0 && a > max / b) return false;
+			if (b < 0 && b < min / a) return false;
+		} else if (a < 0) {
+			if (b > 0 && a < min / b) return false;
+			if (b < 0 && a < max / b) return false;
+		}
+		res = a * b;
+		return true;
+	}
+#endif
+	/// Absolute value of a machine integer, which is always representable as unsigned integer.
+	inline uint abs(sint a) {
+		return a < 0 ? uint(0) - uint(a) : uint(a);
+	}
+	/// Greatest common divisor of two unsigned machine integers.
+	inline uint gcd(uint a, uint b) {
+		while (b != 0) {
+			uint r = a % b;
+			a = b;
+			b = r;
+		}
+		return a;
+	}
+	/// Number of significant bits of an unsigned machine integer, zero for zero.
+	inline std::size_t bitLength(uint n) {
+#if defined(__GNUC__) || defined(__clang__)
+		return n == 0 ? 0 : std::size_t(64 - __builtin_clzll(n));
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		return _BitScanReverse64(&index, n) ? std::size_t(index) + 1 : 0;
+#else
+		std::size_t res = 0;
+		for (; n != 0; n >>= 1) res++;
+		return res;
+#endif
+	}
+	/*
+	 * GMP only offers conversions from and to long, which is only 32 bits wide on LLP64 platforms like Windows.
+	 * Values that do not fit into long are hence imported and exported as unsigned 64 bit words.
+	 */
+	/// Assigns an unsigned machine integer to an mpz_t.
+	inline void assign(mpz_ptr res, uint n) {
+		if (n <= std::numeric_limits<unsigned long>::max()) {
+			mpz_set_ui(res, static_cast<unsigned long>(n));
+		} else {
+			mpz_import(res, 1, -1, sizeof(n), 0, 0, &n);
+		}
+	}
+	/// Assigns a machine integer to an mpz_t.
+	inline void assign(mpz_ptr res, sint n) {
+		if (n >= std::numeric_limits<long>::min() && n <= std::numeric_limits<long>::max()) {
+			mpz_set_si(res, static_cast<long>(n));
+		} else {
+			assign(res, abs(n));
+			if (n < 0) mpz_neg(res, res);
+		}
+	}
+	/// Checks whether an mpz_t is representable as machine integer.
+	inline bool fits(mpz_srcptr n) {
+		if (mpz_fits_slong_p(n)) return true;
+		std::size_t bits = mpz_sizeinbase(n, 2);
+		if (bits < 64) return true;
+		// The smallest machine integer is the only one with 64 significant bits.
+		return bits == 64 && mpz_sgn(n) < 0 && mpz_scan1(n, 0) == 63;
+	}
+	/// Converts an mpz_t to a machine integer, assuming that fits(n) holds.
+	inline sint get(mpz_srcptr n) {
+		assert(fits(n));
+		if (mpz_fits_slong_p(n)) return mpz_get_si(n);
+		uint res = 0;
+		mpz_export(&res, nullptr, -1, sizeof(res), 0, 0, n);
+		return mpz_sgn(n) < 0 ? static_cast<sint>(uint(0) - res) : static_cast<sint>(res);
+	}
+	inline mpz_class toMpz(sint n) {
+		mpz_class res;
+		assign(res.get_mpz_t(), n);
+		return res;
+	}
+	inline mpq_class toMpq(sint num, sint den) {
+		mpq_class res;
+		assign(res.get_num_mpz_t(), num);
+		assign(res.get_den_mpz_t(), den);
+		return res;
+	}
+}
+
+/**
+ * Integer that is stored as a machine integer if possible and as mpz_class otherwise.
+ */
+class HybridInteger {
+private:
+	/// Value, if mLarge is not set.
+	sint mSmall = 0;
+	/// Value, if it does not fit into a machine integer.
+	std::unique_ptr<mpz_class> mLarge;
+
+	void normalize() {
+		if (mLarge && hybrid::fits(mLarge->get_mpz_t())) {
+			mSmall = hybrid::get(mLarge->get_mpz_t());
+			mLarge.reset();
+		}
+	}
+	/// Returns a reference to the value as mpz_class, using tmp as storage if necessary.
+	const mpz_class& asMpz(mpz_class& tmp) const {
+		if (mLarge) return *mLarge;
+		hybrid::assign(tmp.get_mpz_t(), mSmall);
+		return tmp;
+	}
+public:
+	HybridInteger() = default;
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridInteger(T n) { // NOLINT
+		if (std::is_signed<T>::value || static_cast<uint>(n) <= static_cast<uint>(std::numeric_limits<sint>::max())) {
+			mSmall = static_cast<sint>(n);
+		} else {
+			mLarge.reset(new mpz_class());
+			hybrid::assign(mLarge->get_mpz_t(), static_cast<uint>(n));
+		}
+	}
+	HybridInteger(const mpz_class& n): mLarge(new mpz_class(n)) { // NOLINT
+		normalize();
+	}
+	HybridInteger(mpz_class&& n): mLarge(new mpz_class(std::move(n))) { // NOLINT
+		normalize();
+	}
+	HybridInteger(const HybridInteger& n): mSmall(n.mSmall), mLarge(n.mLarge ? new mpz_class(*n.mLarge) : nullptr) {}
+	HybridInteger(HybridInteger&& n) noexcept = default;
+
+	HybridInteger& operator=(const HybridInteger& n) {
+		if (n.mLarge) {
+			if (mLarge) *mLarge = *n.mLarge;
+			else mLarge.reset(new mpz_class(*n.mLarge));
+		} else {
+			mLarge.reset();
+			mSmall = n.mSmall;
+		}
+		return *this;
+	}
+	HybridInteger& operator=(HybridInteger&& n) noexcept = default;
+
+	/// Checks if the value is stored as machine integer.
+	bool isSmall() const {
+		return !mLarge;
+	}
+	/// Returns the value as machine integer, asserting that it is small.
+	sint small() const {
+		assert(isSmall());
+		return mSmall;
+	}
+	/// Returns the value as mpz_class, asserting that it is not small.
+	const mpz_class& large() const {
+		assert(!isSmall());
+		return *mLarge;
+	}
+	mpz_class toMpz() const {
+		if (mLarge) return *mLarge;
+		return hybrid::toMpz(mSmall);
+	}
+
+	friend bool operator==(const HybridInteger& lhs, const HybridInteger& rhs) {
+		// As the representation is unique, small and large values are never equal.
+		if (lhs.isSmall() && rhs.isSmall()) return lhs.mSmall == rhs.mSmall;
+		if (lhs.isSmall() || rhs.isSmall()) return false;
+		return *lhs.mLarge == *rhs.mLarge;
+	}
+	friend bool operator!=(const HybridInteger& lhs, const HybridInteger& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator<(const HybridInteger& lhs, const HybridInteger& rhs) {
+		if (lhs.isSmall() && rhs.isSmall()) return lhs.mSmall < rhs.mSmall;
+		mpz_class tl, tr;
+		return lhs.asMpz(tl) < rhs.asMpz(tr);
+	}
+	friend bool operator<=(const HybridInteger& lhs, const HybridInteger& rhs) {
+		return !(rhs < lhs);
+	}
+	friend bool operator>(const HybridInteger& lhs, const HybridInteger& rhs) {
+		return rhs < lhs;
+	}
+	friend bool operator>=(const HybridInteger& lhs, const HybridInteger& rhs) {
+		return !(lhs < rhs);
+	}
+
+	friend HybridInteger operator+(const HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::add(lhs.mSmall, rhs.mSmall, res)) return HybridInteger(res);
+		mpz_class tl, tr;
+		return HybridInteger(mpz_class(lhs.asMpz(tl) + rhs.asMpz(tr)));
+	}
+	friend HybridInteger operator-(const HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::sub(lhs.mSmall, rhs.mSmall, res)) return HybridInteger(res);
+		mpz_class tl, tr;
+		return HybridInteger(mpz_class(lhs.asMpz(tl) - rhs.asMpz(tr)));
+	}
+	friend HybridInteger operator*(const HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::mul(lhs.mSmall, rhs.mSmall, res)) return HybridInteger(res);
+		mpz_class tl, tr;
+		return HybridInteger(mpz_class(lhs.asMpz(tl) * rhs.asMpz(tr)));
+	}
+	/// Quotient of the division, rounding towards zero.
+	friend HybridInteger operator/(const HybridInteger& lhs, const HybridInteger& rhs) {
+		assert(rhs != 0);
+		if (lhs.isSmall() && rhs.isSmall() && !(lhs.mSmall == std::numeric_limits<sint>::min() && rhs.mSmall == -1)) {
+			return HybridInteger(lhs.mSmall / rhs.mSmall);
+		}
+		mpz_class tl, tr, res;
+		mpz_tdiv_q(res.get_mpz_t(), lhs.asMpz(tl).get_mpz_t(), rhs.asMpz(tr).get_mpz_t());
+		return HybridInteger(std::move(res));
+	}
+	/// Remainder of the division, having the sign of the dividend.
+	friend HybridInteger operator%(const HybridInteger& lhs, const HybridInteger& rhs) {
+		assert(rhs != 0);
+		if (lhs.isSmall() && rhs.isSmall()) {
+			if (rhs.mSmall == -1) return HybridInteger(0);
+			return HybridInteger(lhs.mSmall % rhs.mSmall);
+		}
+		mpz_class tl, tr, res;
+		mpz_tdiv_r(res.get_mpz_t(), lhs.asMpz(tl).get_mpz_t(), rhs.asMpz(tr).get_mpz_t());
+		return HybridInteger(std::move(res));
+	}
+	friend HybridInteger operator-(const HybridInteger& n) {
+		sint res;
+		if (n.isSmall() && hybrid::sub(0, n.mSmall, res)) return HybridInteger(res);
+		mpz_class tmp;
+		return HybridInteger(mpz_class(-n.asMpz(tmp)));
+	}
+
+	friend HybridInteger& operator+=(HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::add(lhs.mSmall, rhs.mSmall, res)) lhs.mSmall = res;
+		else lhs = lhs + rhs;
+		return lhs;
+	}
+	friend HybridInteger& operator-=(HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::sub(lhs.mSmall, rhs.mSmall, res)) lhs.mSmall = res;
+		else lhs = lhs - rhs;
+		return lhs;
+	}
+	friend HybridInteger& operator*=(HybridInteger& lhs, const HybridInteger& rhs) {
+		sint res;
+		if (lhs.isSmall() && rhs.isSmall() && hybrid::mul(lhs.mSmall, rhs.mSmall, res)) lhs.mSmall = res;
+		else lhs = lhs * rhs;
+		return lhs;
+	}
+	friend HybridInteger& operator/=(HybridInteger& lhs, const HybridInteger& rhs) {
+		return lhs = lhs / rhs;
+	}
+	friend HybridInteger& operator%=(HybridInteger& lhs, const HybridInteger& rhs) {
+		return lhs = lhs % rhs;
+	}
+	friend HybridInteger& operator++(HybridInteger& n) {
+		return n += 1;
+	}
+	friend HybridInteger& operator--(HybridInteger& n) {
+		return n -= 1;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const HybridInteger& n) {
+		if (n.isSmall()) return os << n.mSmall;
+		return os << *n.mLarge;
+	}
+};
+
+/**
+ * Rational number that is stored as a pair of machine integers if possible and as mpq_class otherwise.
+ * Small values are kept in canonical form, i.e. the denominator is positive and coprime to the numerator.
+ */
+class HybridRational {
+private:
+	/// Numerator, if mLarge is not set.
+	sint mNum = 0;
+	/// Denominator, if mLarge is not set.
+	sint mDen = 1;
+	/// Value, if numerator or denominator do not fit into a machine integer.
+	std::unique_ptr<mpq_class> mLarge;
+
+	void normalize() {
+		if (mLarge && hybrid::fits(mLarge->get_num_mpz_t()) && hybrid::fits(mLarge->get_den_mpz_t())) {
+			mNum = hybrid::get(mLarge->get_num_mpz_t());
+			mDen = hybrid::get(mLarge->get_den_mpz_t());
+			mLarge.reset();
+		}
+	}
+	/// Returns a reference to the value as mpq_class, using tmp as storage if necessary.
+	const mpq_class& asMpq(mpq_class& tmp) const {
+		if (mLarge) return *mLarge;
+		hybrid::assign(tmp.get_num_mpz_t(), mNum);
+		hybrid::assign(tmp.get_den_mpz_t(), mDen);
+		return tmp;
+	}
+	/// Creates a small value from a canonical fraction.
+	static HybridRational fromSmall(sint num, sint den) {
+		HybridRational res;
+		res.mNum = num;
+		res.mDen = den;
+		return res;
+	}
+
+	/**
+	 * Adds two small fractions as described in @cite Knuth1997 (4.5.1), returns false on overflow.
+	 */
+	static bool add(sint an, sint ad, sint bn, sint bd, sint& rn, sint& rd) {
+		if (ad == 1 && bd == 1) {
+			rd = 1;
+			return hybrid::add(an, bn, rn);
+		}
+		sint g = sint(hybrid::gcd(uint(ad), uint(bd)));
+		sint s, t;
+		if (g == 1) {
+			if (!hybrid::mul(an, bd, s) || !hybrid::mul(bn, ad, t) || !hybrid::add(s, t, rn)) return false;
+			return hybrid::mul(ad, bd, rd);
+		}
+		if (!hybrid::mul(an, bd / g, s) || !hybrid::mul(bn, ad / g, t) || !hybrid::add(s, t, s)) return false;
+		if (s == 0) {
+			rn = 0;
+			rd = 1;
+			return true;
+		}
+		sint g2 = sint(hybrid::gcd(hybrid::abs(s), uint(g)));
+		rn = s / g2;
+		return hybrid::mul(ad / g, bd / g2, rd);
+	}
+	/**
+	 * Multiplies two small fractions, returns false on overflow.
+	 */
+	static bool mul(sint an, sint ad, sint bn, sint bd, sint& rn, sint& rd) {
+		if (an == 0 || bn == 0) {
+			rn = 0;
+			rd = 1;
+			return true;
+		}
+		if (ad == 1 && bd == 1) {
+			rd = 1;
+			return hybrid::mul(an, bn, rn);
+		}
+		// The gcds divide the denominators and thus fit into a sint.
+		sint g1 = sint(hybrid::gcd(hybrid::abs(an), uint(bd)));
+		sint g2 = sint(hybrid::gcd(hybrid::abs(bn), uint(ad)));
+		return hybrid::mul(an / g1, bn / g2, rn) && hybrid::mul(ad / g2, bd / g1, rd);
+	}
+public:
+	HybridRational() = default;
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridRational(T n) { // NOLINT
+		if (std::is_signed<T>::value || static_cast<uint>(n) <= static_cast<uint>(std::numeric_limits<sint>::max())) {
+			mNum = static_cast<sint>(n);
+		} else {
+			mLarge.reset(new mpq_class());
+			hybrid::assign(mLarge->get_num_mpz_t(), static_cast<uint>(n));
+		}
+	}
+	HybridRational(const HybridInteger& n) { // NOLINT
+		if (n.isSmall()) mNum = n.small();
+		else mLarge.reset(new mpq_class(n.large()));
+	}
+	HybridRational(const mpz_class& n): mLarge(new mpq_class(n)) { // NOLINT
+		normalize();
+	}
+	/// Constructs from a fraction in canonical form.
+	HybridRational(const mpq_class& n): mLarge(new mpq_class(n)) { // NOLINT
+		normalize();
+	}
+	HybridRational(mpq_class&& n): mLarge(new mpq_class(std::move(n))) { // NOLINT
+		normalize();
+	}
+	/// Constructs the fraction num / den.
+	HybridRational(const HybridInteger& num, const HybridInteger& den) {
+		assert(den != 0);
+		*this = HybridRational(num) / HybridRational(den);
+	}
+	explicit HybridRational(double d): HybridRational(mpq_class(d)) {
+		assert(!std::isinf(d) && !std::isnan(d));
+	}
+	HybridRational(const HybridRational& n): mNum(n.mNum), mDen(n.mDen), mLarge(n.mLarge ? new mpq_class(*n.mLarge) : nullptr) {}
+	HybridRational(HybridRational&& n) noexcept = default;
+
+	HybridRational& operator=(const HybridRational& n) {
+		if (n.mLarge) {
+			if (mLarge) *mLarge = *n.mLarge;
+			else mLarge.reset(new mpq_class(*n.mLarge));
+		} else {
+			mLarge.reset();
+			mNum = n.mNum;
+			mDen = n.mDen;
+		}
+		return *this;
+	}
+	HybridRational& operator=(HybridRational&& n) noexcept = default;
+
+	/// Checks if the value is stored as a pair of machine integers.
+	bool isSmall() const {
+		return !mLarge;
+	}
+	/// Returns the numerator as machine integer, asserting that the value is small.
+	sint smallNum() const {
+		assert(isSmall());
+		return mNum;
+	}
+	/// Returns the denominator as machine integer, asserting that the value is small.
+	sint smallDen() const {
+		assert(isSmall());
+		return mDen;
+	}
+	/// Returns the value as mpq_class, asserting that it is not small.
+	const mpq_class& large() const {
+		assert(!isSmall());
+		return *mLarge;
+	}
+	HybridInteger num() const {
+		if (mLarge) return HybridInteger(mLarge->get_num());
+		return HybridInteger(mNum);
+	}
+	HybridInteger den() const {
+		if (mLarge) return HybridInteger(mLarge->get_den());
+		return HybridInteger(mDen);
+	}
+	mpq_class toMpq() const {
+		if (mLarge) return *mLarge;
+		return hybrid::toMpq(mNum, mDen);
+	}
+
+	friend bool operator==(const HybridRational& lhs, const HybridRational& rhs) {
+		// As the representation is unique, small and large values are never equal.
+		if (lhs.isSmall() && rhs.isSmall()) return lhs.mNum == rhs.mNum && lhs.mDen == rhs.mDen;
+		if (lhs.isSmall() || rhs.isSmall()) return false;
+		return *lhs.mLarge == *rhs.mLarge;
+	}
+	friend bool operator!=(const HybridRational& lhs, const HybridRational& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator<(const HybridRational& lhs, const HybridRational& rhs) {
+		if (lhs.isSmall() && rhs.isSmall()) {
+			if (lhs.mDen == rhs.mDen) return lhs.mNum < rhs.mNum;
+			sint l, r;
+			if (hybrid::mul(lhs.mNum, rhs.mDen, l) && hybrid::mul(rhs.mNum, lhs.mDen, r)) return l < r;
+		}
+		mpq_class tl, tr;
+		return lhs.asMpq(tl) < rhs.asMpq(tr);
+	}
+	friend bool operator<=(const HybridRational& lhs, const HybridRational& rhs) {
+		return !(rhs < lhs);
+	}
+	friend bool operator>(const HybridRational& lhs, const HybridRational& rhs) {
+		return rhs < lhs;
+	}
+	friend bool operator>=(const HybridRational& lhs, const HybridRational& rhs) {
+		return !(lhs < rhs);
+	}
+
+	friend HybridRational operator+(const HybridRational& lhs, const HybridRational& rhs) {
+		sint num, den;
+		if (lhs.isSmall() && rhs.isSmall() && add(lhs.mNum, lhs.mDen, rhs.mNum, rhs.mDen, num, den)) return fromSmall(num, den);
+		mpq_class tl, tr;
+		return HybridRational(mpq_class(lhs.asMpq(tl) + rhs.asMpq(tr)));
+	}
+	friend HybridRational operator-(const HybridRational& lhs, const HybridRational& rhs) {
+		sint num, den;
+		if (lhs.isSmall() && rhs.isSmall() && rhs.mNum != std::numeric_limits<sint>::min() && add(lhs.mNum, lhs.mDen, -rhs.mNum, rhs.mDen, num, den)) return fromSmall(num, den);
+		mpq_class tl, tr;
+		return HybridRational(mpq_class(lhs.asMpq(tl) - rhs.asMpq(tr)));
+	}
+	friend HybridRational operator*(const HybridRational& lhs, const HybridRational& rhs) {
+		sint num, den;
+		if (lhs.isSmall() && rhs.isSmall() && mul(lhs.mNum, lhs.mDen, rhs.mNum, rhs.mDen, num, den)) return fromSmall(num, den);
+		mpq_class tl, tr;
+		return HybridRational(mpq_class(lhs.asMpq(tl) * rhs.asMpq(tr)));
+	}
+	friend HybridRational operator/(const HybridRational& lhs, const HybridRational& rhs) {
+		assert(rhs != 0);
+		if (lhs.isSmall() && rhs.isSmall() && rhs.mNum != std::numeric_limits<sint>::min()) {
+			// Multiply with the reciprocal, whose denominator must be positive.
+			sint rnum = rhs.mNum < 0 ? -rhs.mDen : rhs.mDen;
+			sint rden = rhs.mNum < 0 ? -rhs.mNum : rhs.mNum;
+			sint num, den;
+			if (mul(lhs.mNum, lhs.mDen, rnum, rden, num, den)) return fromSmall(num, den);
+		}
+		mpq_class tl, tr, res;
+		mpq_div(res.get_mpq_t(), lhs.asMpq(tl).get_mpq_t(), rhs.asMpq(tr).get_mpq_t());
+		return HybridRational(std::move(res));
+	}
+	friend HybridRational operator-(const HybridRational& n) {
+		if (n.isSmall() && n.mNum != std::numeric_limits<sint>::min()) return fromSmall(-n.mNum, n.mDen);
+		mpq_class tmp;
+		return HybridRational(mpq_class(-n.asMpq(tmp)));
+	}
+
+	friend HybridRational& operator+=(HybridRational& lhs, const HybridRational& rhs) {
+		sint num, den;
+		if (lhs.isSmall() && rhs.isSmall() && add(lhs.mNum, lhs.mDen, rhs.mNum, rhs.mDen, num, den)) {
+			lhs.mNum = num;
+			lhs.mDen = den;
+			return lhs;
+		}
+		return lhs = lhs + rhs;
+	}
+	friend HybridRational& operator-=(HybridRational& lhs, const HybridRational& rhs) {
+		return lhs = lhs - rhs;
+	}
+	friend HybridRational& operator*=(HybridRational& lhs, const HybridRational& rhs) {
+		sint num, den;
+		if (lhs.isSmall() && rhs.isSmall() && mul(lhs.mNum, lhs.mDen, rhs.mNum, rhs.mDen, num, den)) {
+			lhs.mNum = num;
+			lhs.mDen = den;
+			return lhs;
+		}
+		return lhs = lhs * rhs;
+	}
+	friend HybridRational& operator/=(HybridRational& lhs, const HybridRational& rhs) {
+		return lhs = lhs / rhs;
+	}
+	friend HybridRational& operator++(HybridRational& n) {
+		return n += 1;
+	}
+	friend HybridRational& operator--(HybridRational& n) {
+		return n -= 1;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const HybridRational& n) {
+		if (!n.isSmall()) return os << *n.mLarge;
+		os << n.mNum;
+		if (n.mDen != 1) os << "/" << n.mDen;
+		return os;
+	}
+};
+
+}
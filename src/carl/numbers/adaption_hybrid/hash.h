@@ -0,0 +1,36 @@
+/**
+ * @file   adaption_hybrid/hash.h
+ * @ingroup hybrid
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../../util/hash.h"
+#include "HybridNumbers.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace std {
+
+template<>
+struct hash<carl::HybridInteger> {
+	std::size_t operator()(const carl::HybridInteger& z) const {
+		if (z.isSmall()) return std::hash<carl::sint>()(z.small());
+		return std::hash<mpz_class>()(z.large());
+	}
+};
+
+template<>
+struct hash<carl::HybridRational> {
+	std::size_t operator()(const carl::HybridRational& q) const {
+		if (q.isSmall()) return carl::hash_all(q.smallNum(), q.smallDen());
+		return std::hash<mpq_class>()(q.large());
+	}
+};
+
+}
@@ -0,0 +1,80 @@
+#include "../numbers.h"
+
+#include <sstream>
+
+namespace carl
+{
+	// Roots and parsing are rare compared to arithmetic, hence they are computed via GMP.
+
+	bool sqrt_exact(const HybridRational& a, HybridRational& b) {
+		mpq_class res;
+		if (!carl::sqrt_exact(a.toMpq(), res)) return false;
+		b = HybridRational(std::move(res));
+		return true;
+	}
+
+	HybridRational sqrt(const HybridRational& a) {
+		return HybridRational(carl::sqrt(a.toMpq()));
+	}
+
+	std::pair<HybridRational,HybridRational> sqrt_safe(const HybridRational& a) {
+		auto res = carl::sqrt_safe(a.toMpq());
+		return std::make_pair(HybridRational(res.first), HybridRational(res.second));
+	}
+
+	std::pair<HybridRational,HybridRational> root_safe(const HybridRational& a, uint n) {
+		auto res = carl::root_safe(a.toMpq(), n);
+		return std::make_pair(HybridRational(res.first), HybridRational(res.second));
+	}
+
+	template<>
+	HybridInteger parse<HybridInteger>(const std::string& n) {
+		return HybridInteger(parse<mpz_class>(n));
+	}
+
+	template<>
+	bool try_parse<HybridInteger>(const std::string& n, HybridInteger& res) {
+		mpz_class tmp;
+		if (!try_parse<mpz_class>(n, tmp)) return false;
+		res = HybridInteger(std::move(tmp));
+		return true;
+	}
+
+	template<>
+	HybridRational parse<HybridRational>(const std::string& n) {
+		return HybridRational(parse<mpq_class>(n));
+	}
+
+	template<>
+	bool try_parse<HybridRational>(const std::string& n, HybridRational& res) {
+		mpq_class tmp;
+		if (!try_parse<mpq_class>(n, tmp)) return false;
+		res = HybridRational(std::move(tmp));
+		return true;
+	}
+
+	std::string toString(const HybridRational& _number, bool _infix) {
+		if (_number.isSmall()) {
+			std::stringstream s;
+			bool negative = isNegative(_number);
+			if (negative) s << "(-" << (_infix ? "" : " ");
+			if (_infix || _number.smallDen() == 1) s << carl::abs(_number);
+			else s << "(/ " << hybrid::abs(_number.smallNum()) << " " << _number.smallDen() << ")";
+			if (negative) s << ")";
+			return s.str();
+		}
+		return toString(_number.large(), _infix);
+	}
+
+	std::string toString(const HybridInteger& _number, bool _infix) {
+		if (_number.isSmall()) {
+			std::stringstream s;
+			bool negative = isNegative(_number);
+			if (negative) s << "(-" << (_infix ? "" : " ");
+			s << hybrid::abs(_number.small());
+			if (negative) s << ")";
+			return s.str();
+		}
+		return toString(_number.large(), _infix);
+	}
+}
@@ -0,0 +1,432 @@
+/**
+ * @file   adaption_hybrid/operations.h
+ * @ingroup hybrid
+ *
+ * @warning This file should never be included directly but only via operations.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../adaption_gmpxx/operations.h"
+#include "HybridNumbers.h"
+#include "typetraits.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace carl {
+
+/**
+ * Informational functions
+ *
+ * The following functions return informations about the given numbers.
+ */
+inline bool isZero(const HybridInteger& n) {
+	return n.isSmall() && n.small() == 0;
+}
+
+inline bool isZero(const HybridRational& n) {
+	return n.isSmall() && n.smallNum() == 0;
+}
+
+inline bool isOne(const HybridInteger& n) {
+	return n.isSmall() && n.small() == 1;
+}
+
+inline bool isOne(const HybridRational& n) {
+	return n.isSmall() && n.smallNum() == 1 && n.smallDen() == 1;
+}
+
+inline bool isPositive(const HybridInteger& n) {
+	if (n.isSmall()) return n.small() > 0;
+	return sgn(n.large()) > 0;
+}
+
+inline bool isPositive(const HybridRational& n) {
+	if (n.isSmall()) return n.smallNum() > 0;
+	return sgn(n.large()) > 0;
+}
+
+inline bool isNegative(const HybridInteger& n) {
+	if (n.isSmall()) return n.small() < 0;
+	return sgn(n.large()) < 0;
+}
+
+inline bool isNegative(const HybridRational& n) {
+	if (n.isSmall()) return n.smallNum() < 0;
+	return sgn(n.large()) < 0;
+}
+
+inline HybridInteger getNum(const HybridRational& n) {
+	return n.num();
+}
+
+inline HybridInteger getNum(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger getDenom(const HybridRational& n) {
+	return n.den();
+}
+
+inline HybridInteger getDenom(const HybridInteger& /*unused*/) {
+	return constant_one<HybridInteger>::get();
+}
+
+inline bool isInteger(const HybridRational& n) {
+	if (n.isSmall()) return n.smallDen() == 1;
+	return n.large().get_den() == 1;
+}
+
+inline bool isInteger(const HybridInteger& /*unused*/) {
+	return true;
+}
+
+/**
+ * Get the bit size of the representation of a integer.
+ * @param n An integer.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const HybridInteger& n) {
+	if (n.isSmall()) return n.small() == 0 ? 1 : hybrid::bitLength(hybrid::abs(n.small()));
+	return carl::bitsize(n.large());
+}
+/**
+ * Get the bit size of the representation of a fraction.
+ * @param n A fraction.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const HybridRational& n) {
+	if (n.isSmall()) return carl::bitsize(HybridInteger(n.smallNum())) + carl::bitsize(HybridInteger(n.smallDen()));
+	return carl::bitsize(n.large());
+}
+
+/**
+ * Conversion functions
+ *
+ * The following function convert types to other types.
+ */
+
+inline double toDouble(const HybridInteger& n) {
+	if (n.isSmall()) return double(n.small());
+	return n.large().get_d();
+}
+inline double toDouble(const HybridRational& n) {
+	// Integers below 2^53 are exact doubles, hence the division is correctly rounded.
+	static constexpr sint exact = sint(1) << std::numeric_limits<double>::digits;
+	if (n.isSmall() && n.smallNum() < exact && n.smallNum() > -exact && n.smallDen() < exact) {
+		return double(n.smallNum()) / double(n.smallDen());
+	}
+	return n.toMpq().get_d();
+}
+
+template<typename Integer>
+inline Integer toInt(const HybridInteger& n);
+
+template<>
+inline sint toInt<sint>(const HybridInteger& n) {
+	assert(n.isSmall());
+	return n.small();
+}
+template<>
+inline uint toInt<uint>(const HybridInteger& n) {
+	if (n.isSmall()) {
+		assert(n.small() >= 0);
+		return uint(n.small());
+	}
+	return toInt<uint>(n.large());
+}
+
+template<typename Integer>
+inline Integer toInt(const HybridRational& n);
+
+/**
+ * Convert a fraction to an integer.
+ * This method assert, that the given fraction is an integer, i.e. that the denominator is one.
+ * @param n A fraction.
+ * @return An integer.
+ */
+template<>
+inline HybridInteger toInt<HybridInteger>(const HybridRational& n) {
+	assert(isInteger(n));
+	return getNum(n);
+}
+template<>
+inline sint toInt<sint>(const HybridRational& n) {
+	return toInt<sint>(toInt<HybridInteger>(n));
+}
+template<>
+inline uint toInt<uint>(const HybridRational& n) {
+	return toInt<uint>(toInt<HybridInteger>(n));
+}
+
+template<>
+inline HybridInteger fromInt(const uint& n) {
+	return HybridInteger(n);
+}
+
+template<>
+inline HybridInteger fromInt(const sint& n) {
+	return HybridInteger(n);
+}
+
+template<>
+inline HybridRational fromInt(const uint& n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational fromInt(const sint& n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(float n) {
+	return HybridRational(double(n));
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(double n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(int n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(uint n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(sint n) {
+	return HybridRational(n);
+}
+
+template<>
+HybridInteger parse<HybridInteger>(const std::string& n);
+
+template<>
+bool try_parse<HybridInteger>(const std::string& n, HybridInteger& res);
+
+template<>
+HybridRational parse<HybridRational>(const std::string& n);
+
+template<>
+bool try_parse<HybridRational>(const std::string& n, HybridRational& res);
+
+/**
+ * Basic Operators
+ *
+ * The following functions implement simple operations on the given numbers.
+ */
+
+inline HybridInteger abs(const HybridInteger& n) {
+	return isNegative(n) ? HybridInteger(-n) : n;
+}
+
+inline HybridRational abs(const HybridRational& n) {
+	return isNegative(n) ? HybridRational(-n) : n;
+}
+
+inline HybridInteger floor(const HybridRational& n) {
+	if (n.isSmall()) {
+		// Division rounds towards zero, hence negative non-integral values have to be corrected.
+		sint res = n.smallNum() / n.smallDen();
+		if (n.smallNum() < 0 && n.smallDen() != 1) res--;
+		return HybridInteger(res);
+	}
+	return HybridInteger(carl::floor(n.large()));
+}
+
+inline HybridInteger floor(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger ceil(const HybridRational& n) {
+	if (n.isSmall()) {
+		sint res = n.smallNum() / n.smallDen();
+		if (n.smallNum() > 0 && n.smallDen() != 1) res++;
+		return HybridInteger(res);
+	}
+	return HybridInteger(carl::ceil(n.large()));
+}
+
+inline HybridInteger ceil(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger round(const HybridRational& n) {
+	if (n.isSmall() && n.smallDen() == 1) return HybridInteger(n.smallNum());
+	return HybridInteger(carl::round(n.toMpq()));
+}
+
+inline HybridInteger round(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger gcd(const HybridInteger& a, const HybridInteger& b) {
+	if (a.isSmall() && b.isSmall()) {
+		// The gcd of two machine integers only exceeds the range for gcd(min, min) or gcd(min, 0).
+		uint res = hybrid::gcd(hybrid::abs(a.small()), hybrid::abs(b.small()));
+		return HybridInteger(res);
+	}
+	return HybridInteger(carl::gcd(a.toMpz(), b.toMpz()));
+}
+
+inline HybridInteger lcm(const HybridInteger& a, const HybridInteger& b) {
+	if (isZero(a) || isZero(b)) return constant_zero<HybridInteger>::get();
+	return carl::abs(a / carl::gcd(a, b) * b);
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions, that is the gcd of the numerators divided by the lcm of the denominators.
+ */
+inline HybridRational gcd(const HybridRational& a, const HybridRational& b) {
+	return HybridRational(carl::gcd(getNum(a), getNum(b)), carl::lcm(getDenom(a), getDenom(b)));
+}
+
+/**
+ * Calculate the least common multiple of two fractions, that is the lcm of the numerators divided by the gcd of the denominators.
+ */
+inline HybridRational lcm(const HybridRational& a, const HybridRational& b) {
+	return HybridRational(carl::lcm(getNum(a), getNum(b)), carl::gcd(getDenom(a), getDenom(b)));
+}
+
+/**
+ * Calculate the greatest common divisor of two integers.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridInteger& gcd_assign(HybridInteger& a, const HybridInteger& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridRational& gcd_assign(HybridRational& a, const HybridRational& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+/**
+ * Calculate the square root of a fraction if possible.
+ *
+ * @param a The fraction to calculate the square root for.
+ * @param b A reference to the rational, in which the result is stored.
+ * @return true, if the number to calculate the square root for is a square;
+ *         false, otherwise.
+ */
+bool sqrt_exact(const HybridRational& a, HybridRational& b);
+
+HybridRational sqrt(const HybridRational& a);
+
+std::pair<HybridRational,HybridRational> sqrt_safe(const HybridRational& a);
+
+/**
+ * Calculate the nth root of a fraction.
+ * The precise result is contained in the resulting interval.
+ */
+std::pair<HybridRational,HybridRational> root_safe(const HybridRational& a, uint n);
+
+inline HybridInteger mod(const HybridInteger& n, const HybridInteger& m) {
+	return n % m;
+}
+
+inline HybridInteger remainder(const HybridInteger& n, const HybridInteger& m) {
+	return n % m;
+}
+
+inline HybridInteger quotient(const HybridInteger& n, const HybridInteger& d) {
+	return n / d;
+}
+
+/**
+ * Divides two integers, rounding the quotient towards negative infinity like mpz_divmod.
+ * The remainder has the sign of the divisor.
+ */
+inline void divide(const HybridInteger& dividend, const HybridInteger& divisor, HybridInteger& quotient, HybridInteger& remainder) {
+	quotient = dividend / divisor;
+	remainder = dividend % divisor;
+	if (!isZero(remainder) && isNegative(remainder) != isNegative(divisor)) {
+		quotient -= 1;
+		remainder += divisor;
+	}
+}
+
+inline HybridRational quotient(const HybridRational& n, const HybridRational& d) {
+	return n / d;
+}
+
+/**
+ * Divide two fractions.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridRational div(const HybridRational& a, const HybridRational& b) {
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridInteger div(const HybridInteger& a, const HybridInteger& b) {
+	assert(isZero(carl::mod(a, b)));
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridInteger& div_assign(HybridInteger& a, const HybridInteger& b) {
+	a = carl::div(a, b);
+	return a;
+}
+
+/**
+ * Divide two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridRational& div_assign(HybridRational& a, const HybridRational& b) {
+	a /= b;
+	return a;
+}
+
+inline HybridRational reciprocal(const HybridRational& a) {
+	return HybridRational(1) / a;
+}
+
+std::string toString(const HybridRational& _number, bool _infix=true);
+
+std::string toString(const HybridInteger& _number, bool _infix=true);
+
+}
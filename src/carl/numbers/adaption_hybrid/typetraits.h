@@ -0,0 +1,24 @@
+/**
+ * @file   adaption_hybrid/typetraits.h
+ * @ingroup typetraits
+ * @ingroup hybrid
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../typetraits.h"
+#include "HybridNumbers.h"
+
+namespace carl {
+
+TRAIT_TRUE(is_integer, HybridInteger, hybrid);
+TRAIT_TRUE(is_rational, HybridRational, hybrid);
+
+TRAIT_TYPE(IntegralType, HybridRational, HybridInteger, hybrid);
+TRAIT_TYPE(IntegralType, HybridInteger, HybridInteger, hybrid);
+
+}
@@ -12,4 +12,5 @@ namespace carl {
 
 #include "cln_gmp.h"
 #include "generic.h"
+#include "hybrid_gmp.h"
 #include "native.h"
@@ -0,0 +1,35 @@
+#pragma once
+
+namespace carl {
+
+	template<>
+	inline HybridInteger convert<mpz_class, HybridInteger>(const mpz_class& n) {
+		return HybridInteger(n);
+	}
+
+	template<>
+	inline mpz_class convert<HybridInteger, mpz_class>(const HybridInteger& n) {
+		return n.toMpz();
+	}
+
+	template<>
+	inline HybridRational convert<mpq_class, HybridRational>(const mpq_class& n) {
+		return HybridRational(n);
+	}
+
+	template<>
+	inline mpq_class convert<HybridRational, mpq_class>(const HybridRational& n) {
+		return n.toMpq();
+	}
+
+	template<>
+	inline double convert<HybridRational, double>(const HybridRational& n) {
+		return carl::toDouble(n);
+	}
+
+	template<>
+	inline HybridRational convert<double, HybridRational>(const double& n) {
+		return carl::rationalize<HybridRational>(n);
+	}
+
+}
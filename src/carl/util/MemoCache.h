@@ -0,0 +1,154 @@
+/**
+ * @file MemoCache.h
+ *
+ * A bounded cache that memoizes the results of expensive functions.
+ * Other than Cache, which stores reference counted objects, the entries are owned by the cache and may be evicted at any time.
+ */
+
+#pragma once
+
+#include "../config.h"
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#ifdef THREAD_SAFE
+#include <mutex>
+#endif
+
+namespace carl {
+
+/**
+ * Statistics of a MemoCache.
+ */
+struct MemoCacheStatistics {
+	/// Number of lookups that were answered from the cache.
+	std::size_t hits = 0;
+	/// Number of lookups that computed a new value.
+	std::size_t misses = 0;
+	/// Number of entries that were evicted to respect the budget.
+	std::size_t evictions = 0;
+	/// Number of entries currently stored.
+	std::size_t entries = 0;
+	/// Total weight of the entries currently stored.
+	std::size_t weight = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const MemoCacheStatistics& s) {
+	return os << "hits: " << s.hits << ", misses: " << s.misses << ", evictions: " << s.evictions << ", entries: " << s.entries << ", weight: " << s.weight;
+}
+
+/**
+ * Maps keys to values computed by some function, evicting the least recently used entries.
+ * Every entry is assigned a weight that approximates its memory consumption, and the total weight of all entries is kept below the budget.
+ * If THREAD_SAFE is defined, all methods are thread-safe, values are computed outside of the lock such that several threads can compute different values at the same time.
+ * The key is only stored in the entry, the index refers to it, hence the weight of an entry covers all memory it occupies.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class MemoCache {
+private:
+	struct Entry {
+		Key key;
+		Value value;
+		std::size_t weight;
+	};
+	using KeyRef = std::reference_wrapper<const Key>;
+	struct KeyRefHash {
+		std::size_t operator()(const KeyRef& k) const {
+			return Hash()(k.get());
+		}
+	};
+	struct KeyRefEqual {
+		bool operator()(const KeyRef& lhs, const KeyRef& rhs) const {
+			return lhs.get() == rhs.get();
+		}
+	};
+	/// Entries, the most recently used entry first.
+	std::list<Entry> mEntries;
+	/// Maps keys to their entries, the keys refer to the keys stored in the entries.
+	std::unordered_map<KeyRef, typename std::list<Entry>::iterator, KeyRefHash, KeyRefEqual> mIndex;
+	/// Maximum total weight.
+	std::size_t mBudget;
+	/// Statistics, also holds the current weight.
+	MemoCacheStatistics mStatistics;
+#ifdef THREAD_SAFE
+	mutable std::mutex mMutex;
+#define MEMOCACHE_LOCK std::lock_guard<std::mutex> lock(mMutex)
+#else
+#define MEMOCACHE_LOCK
+#endif
+
+	/// Removes the least recently used entries until the total weight is within the budget.
+	void shrink() {
+		while (mStatistics.weight > mBudget && !mEntries.empty()) {
+			mStatistics.weight -= mEntries.back().weight;
+			mIndex.erase(std::cref(mEntries.back().key));
+			mEntries.pop_back();
+			mStatistics.evictions++;
+		}
+		mStatistics.entries = mEntries.size();
+	}
+public:
+	explicit MemoCache(std::size_t budget): mBudget(budget) {}
+
+	/**
+	 * Returns the value for the given key.
+	 * If the key is not cached, the value is computed and stored, unless its weight exceeds the budget.
+	 * @param key Key.
+	 * @param compute Function that computes the value.
+	 * @param weight Function that estimates the weight of a key and its value.
+	 * @return Value for the key.
+	 */
+	template<typename Compute, typename Weight>
+	Value get(const Key& key, Compute&& compute, Weight&& weight) {
+		{
+			MEMOCACHE_LOCK;
+			auto it = mIndex.find(std::cref(key));
+			if (it != mIndex.end()) {
+				mStatistics.hits++;
+				mEntries.splice(mEntries.begin(), mEntries, it->second);
+				return it->second->value;
+			}
+			mStatistics.misses++;
+		}
+		Value value = compute();
+		std::size_t w = weight(key, value);
+		MEMOCACHE_LOCK;
+		if (w > mBudget || mIndex.find(std::cref(key)) != mIndex.end()) return value;
+		mEntries.push_front(Entry{key, value, w});
+		mIndex.emplace(std::cref(mEntries.front().key), mEntries.begin());
+		mStatistics.weight += w;
+		shrink();
+		return value;
+	}
+
+	/// Returns the current budget.
+	std::size_t budget() const {
+		MEMOCACHE_LOCK;
+		return mBudget;
+	}
+	/// Sets the budget, evicting entries if necessary.
+	void setBudget(std::size_t budget) {
+		MEMOCACHE_LOCK;
+		mBudget = budget;
+		shrink();
+	}
+	/// Returns a copy of the statistics.
+	MemoCacheStatistics statistics() const {
+		MEMOCACHE_LOCK;
+		return mStatistics;
+	}
+	/// Removes all entries and resets the statistics.
+	void clear() {
+		MEMOCACHE_LOCK;
+		mEntries.clear();
+		mIndex.clear();
+		mStatistics = MemoCacheStatistics();
+	}
+};
+
+}
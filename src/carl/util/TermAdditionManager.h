@@ -1,19 +1,21 @@
-/* 
+/*
  * File:   TermAdditionManager.h
  * Author: Florian Corzilius
  *
  * Created on October 30, 2014, 7:20 AM
  */
 
-#pragma once 
+#pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <list>
-#include <mutex>
-#include <tuple>
 #include <unordered_map>
 #include <vector>
 
 #include "../config.h"
+#include "../core/MonomialPool.h"
 #include "../core/Term.h"
 #include "../io/streamingOperators.h"
 #include "pointerOperations.h"
@@ -21,6 +23,31 @@
 namespace carl
 {
 
+/**
+ * Counter of release requests, see releaseTermAdditionManagers().
+ */
+inline std::atomic<std::size_t>& termAdditionManagerReleaseRequests() {
+	static std::atomic<std::size_t> requests(0);
+	return requests;
+}
+
+/**
+ * Asks all TermAdditionManager objects (of all threads) to release the scratch memory of their idle entries.
+ * As every thread owns its managers, the memory is released lazily when the respective manager is used the next time.
+ */
+inline void releaseTermAdditionManagers() {
+	++termAdditionManagerReleaseRequests();
+}
+
+/**
+ * Collects terms and adds up terms with equal monomials.
+ *
+ * Every entry maps the global IDs of monomials to local IDs, i.e. positions within a vector of terms.
+ * As long as the monomial IDs are small, this map is a dense vector. Once the monomial IDs exceed a certain bound,
+ * a hash map is used instead, hence the memory does not grow with the number of monomials ever created.
+ *
+ * A manager is not synchronized and should only be used by a single thread, see MultivariatePolynomial::termAdditionManager().
+ */
 template<typename Polynomial, typename Ordering>
 class TermAdditionManager {
 public:
@@ -29,89 +56,144 @@ public:
 	using TermType = Term<Coeff>;
 	using TermPtr = TermType;
 	using TermIDs = std::vector<IDType>;
-	using Terms = std::vector<TermPtr>;
-	/* 0: Maps global IDs to local IDs.
-	 * 1: Actual terms by local IDs.
-	 * 2: Flag if this entry is currently used.
-	 * 3: Constant part.
-	 * 4: Next free local ID.
-	 */
-	using Tuple = std::tuple<TermIDs,Terms,bool,Coeff,IDType>;
-	using TAMId = typename std::list<Tuple>::iterator;
+	using SparseTermIDs = std::unordered_map<std::size_t, IDType>;
+	using Terms = typename Polynomial::TermsType;
+	/// Default bound for monomial IDs that are mapped by a dense vector.
+	static constexpr std::size_t DefaultMaxDenseIDs = 1 << 20;
+	/// Number of terms an idle entry may keep allocated.
+	static constexpr std::size_t MaxIdleTerms = 1 << 14;
+
+	struct Entry {
+		/// Maps global IDs to local IDs, if the global IDs are small.
+		TermIDs termIDs;
+		/// Maps global IDs to local IDs otherwise.
+		SparseTermIDs sparseIDs;
+		/// Flag if sparseIDs is used.
+		bool sparse = false;
+		/// Actual terms by local IDs.
+		Terms terms;
+		/// Flag if this entry is currently used.
+		bool used = false;
+		/// Constant part.
+		Coeff constant = constant_zero<Coeff>::get();
+		/// Next free local ID.
+		IDType nextID = 1;
+	};
+	using TAMId = typename std::list<Entry>::iterator;
 private:
-	std::list<Tuple> mData;
+	std::list<Entry> mData;
 	TAMId mNextId;
-	mutable std::mutex mMutex;
-    
-    #ifdef THREAD_SAFE
-    #define TAM_LOCK_GUARD std::lock_guard<std::mutex> lock( mMutex );
-    #define TAM_LOCK mMutex.lock();
-    #define TAM_UNLOCK mMutex.unlock();
-    #else
-    #define TAM_LOCK_GUARD
-    #define TAM_LOCK
-    #define TAM_UNLOCK
-    #endif
-	
-	TAMId createNewEntry() {
-		TAMId res = mData.emplace(mData.end());
-		std::get<4>(*res) = 1;
-		return res;
+	/// Bound for monomial IDs that are mapped by a dense vector.
+	std::size_t mMaxDenseIDs;
+	/// Number of release requests that have already been processed.
+	std::size_t mReleaseRequests;
+
+	/**
+	 * Switches the given entry to the sparse map, moving all current mappings.
+	 */
+	void makeSparse(Entry& data) {
+		assert(!data.sparse);
+		for (IDType i = 1; i < data.nextID && i < data.terms.size(); i++) {
+			const TermType& t = data.terms[i];
+			if (t.isZero()) continue;
+			std::size_t monId = t.monomial()->id();
+			data.sparseIDs[monId] = i;
+			data.termIDs[monId] = 0;
+		}
+		data.sparse = true;
+	}
+
+	/**
+	 * Returns the local ID of the given global monomial ID, zero if there is none yet.
+	 */
+	IDType& localID(Entry& data, std::size_t monId) {
+		if (!data.sparse) {
+			if (monId < data.termIDs.size()) return data.termIDs[monId];
+			if (monId < mMaxDenseIDs) {
+				data.termIDs.resize(std::min(std::max(monId + 1, 2 * data.termIDs.size()), mMaxDenseIDs));
+				return data.termIDs[monId];
+			}
+			makeSparse(data);
+		}
+		return data.sparseIDs[monId];
+	}
+
+	/**
+	 * Removes the mapping for the given global monomial ID.
+	 */
+	void resetLocalID(Entry& data, std::size_t monId) {
+		if (data.sparse) data.sparseIDs.erase(monId);
+		else data.termIDs[monId] = 0;
 	}
-	
-	bool compare(TAMId id, IDType t1, IDType t2) const {
-		Tuple& data = *id;
-		assert(std::get<2>(data));
-		Terms& t = std::get<1>(data);
-		return Ordering::less(t[t1], t[t2]);
+
+	/**
+	 * Marks the given entry as unused. Assumes that all mappings have been reset.
+	 * Scratch memory beyond MaxIdleTerms is released.
+	 */
+	void finish(Entry& data) {
+		if (data.sparse) {
+			// Clearing the map keeps the buckets, hence we replace it altogether.
+			SparseTermIDs().swap(data.sparseIDs);
+			data.sparse = false;
+		}
+		if (data.terms.capacity() > MaxIdleTerms) Terms().swap(data.terms);
+		else data.terms.clear();
+		data.used = false;
 	}
 public:
-	TermAdditionManager() {
+	explicit TermAdditionManager(std::size_t maxDenseIDs = DefaultMaxDenseIDs):
+		mMaxDenseIDs(maxDenseIDs),
+		mReleaseRequests(termAdditionManagerReleaseRequests().load())
+	{
         MonomialPool::getInstance();
-		mNextId = createNewEntry();
+		mNextId = mData.emplace(mData.end());
 	}
-	
-    #define SWAP_TERMS
-	
+
 	TAMId getId(std::size_t expectedSize = 0) {
-		TAM_LOCK_GUARD
-		while (std::get<2>(*mNextId)) {
+		std::size_t requests = termAdditionManagerReleaseRequests().load(std::memory_order_relaxed);
+		if (requests != mReleaseRequests) {
+			mReleaseRequests = requests;
+			release();
+		}
+		while (mNextId->used) {
 			mNextId++;
 			if (mNextId == mData.end()) {
 				mNextId = mData.emplace(mData.end());
-				std::get<4>(*mNextId) = 1;
 			}
 		}
-        Tuple& data = *mNextId;
-        Terms& terms = std::get<1>(data);
-		terms.clear();
-        terms.resize(expectedSize + 1);
-        #ifdef SWAP_TERMS
-        //memset(&terms[0], 0, sizeof(TermPtr)*terms.size());
-        #endif
-        std::size_t greatestIdPlusOne = MonomialPool::getInstance().largestID() + 1;
-		if( std::get<0>(data).size() < greatestIdPlusOne ) std::get<0>(data).resize(greatestIdPlusOne);
-		//memset(&std::get<0>(data)[0], 0, sizeof(IDType)*std::get<0>(data).size());
-		std::get<3>(data) = constant_zero<Coeff>::get();
-		std::get<4>(data) = 1;
-		std::get<2>(data) = true;
+        Entry& data = *mNextId;
+		data.terms.clear();
+		data.terms.resize(expectedSize + 1);
+		std::size_t greatestIdPlusOne = MonomialPool::getInstance().largestID() + 1;
+		if (greatestIdPlusOne > mMaxDenseIDs) {
+			data.sparse = true;
+		} else if (data.termIDs.size() < greatestIdPlusOne) {
+			data.termIDs.resize(greatestIdPlusOne);
+		}
+		data.constant = constant_zero<Coeff>::get();
+		data.nextID = 1;
+		data.used = true;
 		TAMId result = mNextId;
 		mNextId++;
 		if (mNextId == mData.end()) mNextId = mData.begin();
 		return result;
 	}
 
+	/**
+	 * Adds a term.
+	 * @tparam SizeUnknown If the number of terms may exceed the size given to getId().
+	 * @tparam NewMonomials If the monomial may have been created after getId() was called.
+	 */
     template<bool SizeUnknown, bool NewMonomials = true>
 	void addTerm(TAMId id, const TermPtr& term) {
 		assert(!term.isZero());
-        Tuple& data = *id;
-		assert(std::get<2>(data));
-		TermIDs& termIDs = std::get<0>(data);
-		Terms& terms = std::get<1>(data);
+        Entry& data = *id;
+		assert(data.used);
+		Terms& terms = data.terms;
 		if (term.monomial()) {
 			std::size_t monId = term.monomial()->id();
-			if (NewMonomials && monId >= termIDs.size()) termIDs.resize(monId + 1);
-            IDType locId = termIDs[monId];
+			assert(NewMonomials || data.sparse || monId < data.termIDs.size());
+            IDType& locId = localID(data, monId);
 			if (locId != 0) {
 				if (SizeUnknown && locId >= terms.size()) terms.resize(locId + 1);
 				assert(locId < terms.size());
@@ -119,48 +201,46 @@ public:
 				if (!carl::isZero(t.coeff())) {
 					Coeff coeff = t.coeff() + term.coeff();
 					if (carl::isZero(coeff)) {
-						termIDs[monId] = 0;
 						t = std::move(TermType());
+						resetLocalID(data, monId);
 					} else {
 						t.coeff() = std::move(coeff);
 					}
-				} else 
+				} else
                     t = term;
 			} else {
-				IDType& nextID = std::get<4>(data);
+				IDType& nextID = data.nextID;
 				if (SizeUnknown && nextID >= terms.size()) terms.resize(nextID + 1);
 				assert(nextID < terms.size());
 				assert(nextID < std::numeric_limits<IDType>::max());
-				termIDs[monId] = nextID;
+				locId = nextID;
 				terms[nextID] = term;
 				++nextID;
 			}
 		} else {
-			std::get<3>(data) += term.coeff();
+			data.constant += term.coeff();
 		}
 	}
 
 	TermType getMaxTerm(TAMId id) const {
-		Tuple& data = *id;
-		Terms& terms = std::get<1>(data);
+		const Entry& data = *id;
+		const Terms& terms = data.terms;
 		std::size_t max = 0;
 		assert(terms.size() > 0);
 		for (std::size_t i = 1; i < terms.size(); i++) {
 			if (Ordering::less(terms[max], terms[i])) max = i;
 		}
 		assert(!terms[max].isConstant() || terms[max].isZero());
-		if (terms[max].isZero()) return TermType(std::get<3>(data));
+		if (terms[max].isZero()) return TermType(data.constant);
 		else return terms[max];
 	}
-    
+
 	void readTerms(TAMId id, Terms& terms) {
-        Tuple& data = *id;
-		assert(std::get<2>(data));
-		Terms& t = std::get<1>(data);
-        TermIDs& termIDs = std::get<0>(data);
-        #ifdef SWAP_TERMS
-		if (!isZero(std::get<3>(data))) {
-			t[0] = std::move(TermType(std::move(std::get<3>(data)), nullptr));
+        Entry& data = *id;
+		assert(data.used);
+		Terms& t = data.terms;
+		if (!isZero(data.constant)) {
+			t[0] = std::move(TermType(std::move(data.constant), nullptr));
 		}
         for (auto i = t.begin(); i != t.end();) {
 			if (i->isZero()) {
@@ -173,44 +253,53 @@ public:
 					t.pop_back();
 				}
 			} else {
-				if ((*i).monomial()) termIDs[(*i).monomial()->id()] = 0;
+				if (!data.sparse && (*i).monomial()) data.termIDs[(*i).monomial()->id()] = 0;
                 ++i;
             }
 		}
 		std::swap(t, terms);
-		t.clear();
-        #else
-        terms.clear();
-        if (!isZero(std::get<3>(data))) {
-			terms.push_back( std::make_shared<const TermType>(std::move(std::get<3>(data)), nullptr) );
+		finish(data);
+	}
+
+	void dropTerms(TAMId id) {
+		Entry& data = *id;
+		assert(data.used);
+		if (!data.sparse) {
+			for (const auto& t: data.terms) {
+				if (t.monomial()) data.termIDs[t.monomial()->id()] = 0;
+			}
 		}
-        auto i = t.begin();
-        ++i;
-		for (; i != t.end(); ++i)
-        {
-			if (*i)
-            {
-                termIDs[(*i)->monomial()->id()] = 0;
-                terms.push_back( *i );
-                *i = nullptr;
-            }
+		finish(data);
+	}
+
+	/**
+	 * Releases the scratch memory of all entries that are currently not used.
+	 * Entries that are in use stay valid.
+	 */
+	void release() {
+		for (auto it = mData.begin(); it != mData.end();) {
+			if (it->used) ++it;
+			else it = mData.erase(it);
 		}
-		t.clear();
-        #endif
-		TAM_LOCK_GUARD
-		std::get<2>(data) = false;
+		if (mData.empty()) mData.emplace(mData.end());
+		mNextId = mData.begin();
 	}
 
-	void dropTerms(TAMId id) {
-		Tuple& data = *id;
-		assert(std::get<2>(data));
-		Terms& t = std::get<1>(data);
-        TermIDs& termIDs = std::get<0>(data);
-		for (auto i = t.begin(); i != t.end(); i++) {
-			if ((*i).monomial()) termIDs[(*i).monomial()->id()] = 0;
+	/**
+	 * @return Number of entries, i.e. the maximal number of simultaneously used ids so far.
+	 */
+	std::size_t entries() const {
+		return mData.size();
+	}
+	/**
+	 * @return Number of bytes held as scratch memory by all entries, ignoring the hash maps.
+	 */
+	std::size_t memoryUsage() const {
+		std::size_t res = 0;
+		for (const auto& data: mData) {
+			res += data.termIDs.capacity() * sizeof(IDType) + data.terms.capacity() * sizeof(TermType);
 		}
-		TAM_LOCK_GUARD
-		std::get<2>(data) = false;
+		return res;
 	}
 };
 
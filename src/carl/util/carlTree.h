@@ -878,19 +878,49 @@ public:
 			return position;
 		}
 		++position;
+		unlink(id);
+		eraseNode(id);
+		assert(this->isConsistent());
+		return position;
+	}
+	/**
+	 * Remove the subtree at the given position from the tree without releasing its nodes.
+	 * The subtree can be linked again at the same position by reattach(), iterators to its elements stay valid.
+	 * Returns an iterator to the next position.
+	 * @param position Element, must not be the root.
+	 * @return Next element.
+	 */
+	template<typename Iterator>
+	Iterator detach(Iterator position) {
+		std::size_t id = position.current;
+		assert(id != 0);
+		++position;
+		unlink(id);
+		assert(this->isConsistent());
+		return position;
+	}
+	/**
+	 * Link a subtree that was removed by detach() at its former position.
+	 * The former siblings must still be adjacent, which holds if all changes since the detach() have been undone.
+	 * @param position Root of the subtree.
+	 */
+	template<typename Iterator>
+	void reattach(const Iterator& position) {
+		std::size_t id = position.current;
+		std::size_t parent = nodes[id].parent;
 		if (nodes[id].nextSibling != MAXINT) {
-			nodes[nodes[id].nextSibling].previousSibling = nodes[id].previousSibling;
+			assert(nodes[nodes[id].nextSibling].previousSibling == nodes[id].previousSibling);
+			nodes[nodes[id].nextSibling].previousSibling = id;
 		} else {
-			nodes[nodes[id].parent].lastChild = nodes[id].previousSibling;
+			assert(nodes[parent].lastChild == nodes[id].previousSibling);
+			nodes[parent].lastChild = id;
 		}
 		if (nodes[id].previousSibling != MAXINT) {
-			nodes[nodes[id].previousSibling].nextSibling = nodes[id].nextSibling;
+			nodes[nodes[id].previousSibling].nextSibling = id;
 		} else {
-			nodes[nodes[id].parent].firstChild = nodes[id].nextSibling;
+			nodes[parent].firstChild = id;
 		}
-		eraseNode(id);
 		assert(this->isConsistent());
-		return position;
 	}
 	/**
 	 * Erase all children of the given element.
@@ -941,6 +971,19 @@ private:
 		nodes[id].firstChild = MAXINT;
 		nodes[id].lastChild = MAXINT;
 	}
+	/// Unlinks the node from its parent and siblings, the node keeps the links to its former neighbours.
+	void unlink(std::size_t id) {
+		if (nodes[id].nextSibling != MAXINT) {
+			nodes[nodes[id].nextSibling].previousSibling = nodes[id].previousSibling;
+		} else {
+			nodes[nodes[id].parent].lastChild = nodes[id].previousSibling;
+		}
+		if (nodes[id].previousSibling != MAXINT) {
+			nodes[nodes[id].previousSibling].nextSibling = nodes[id].nextSibling;
+		} else {
+			nodes[nodes[id].parent].firstChild = nodes[id].nextSibling;
+		}
+	}
 	void eraseNode(std::size_t id) {
 		eraseChildren(id);
 		nodes[id].nextSibling = emptyNodes;
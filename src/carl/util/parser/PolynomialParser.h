@@ -20,9 +20,11 @@ namespace boost { namespace spirit { namespace traits {
             r = acc / carl::pow(cln::cl_RA(10), unsigned(-exp));
 		return true;
     }
+#if BOOST_VERSION < 107000
     template<> inline bool is_equal_to_one(const cln::cl_RA& value) {
         return value == 1;
     }
+#endif
 }}}
 #endif
 namespace boost { namespace spirit { namespace traits {
@@ -33,12 +35,29 @@ namespace boost { namespace spirit { namespace traits {
             r = acc / carl::pow(mpq_class(10), unsigned(-exp));
 		return true;
     }
+#if BOOST_VERSION < 107000
     template<> inline bool is_equal_to_one(const mpq_class& value) {
         return value == 1;
     }
+#endif
     template<> inline mpq_class negate(bool neg, const mpq_class& n) {
         return neg ? mpq_class(-n) : n;
     }
+    template<> inline bool scale(int exp, carl::HybridRational& r, carl::HybridRational acc) {
+        if (exp >= 0)
+            r = acc * carl::pow(carl::HybridRational(10), unsigned(exp));
+        else
+            r = acc / carl::pow(carl::HybridRational(10), unsigned(-exp));
+		return true;
+    }
+#if BOOST_VERSION < 107000
+    template<> inline bool is_equal_to_one(const carl::HybridRational& value) {
+        return carl::isOne(value);
+    }
+#endif
+    template<> inline carl::HybridRational negate(bool neg, const carl::HybridRational& n) {
+        return neg ? carl::HybridRational(-n) : n;
+    }
 }}}
 #else
 #ifdef USE_CLN_NUMBERS
@@ -67,6 +86,18 @@ namespace boost { namespace spirit { namespace traits {
     template<> inline mpq_class negate(bool neg, const mpq_class& n) {
         return neg ? mpq_class(-n) : n;
     }
+    template<> inline void scale(int exp, carl::HybridRational& n) {
+        if (exp >= 0)
+            n *= carl::pow(carl::HybridRational(10), unsigned(exp));
+        else
+            n /= carl::pow(carl::HybridRational(10), unsigned(-exp));
+    }
+    template<> inline bool is_equal_to_one(const carl::HybridRational& value) {
+        return carl::isOne(value);
+    }
+    template<> inline carl::HybridRational negate(bool neg, const carl::HybridRational& n) {
+        return neg ? carl::HybridRational(-n) : n;
+    }
 }}}
 #endif
 
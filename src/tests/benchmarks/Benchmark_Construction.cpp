@@ -387,6 +387,16 @@ TEST_F(BenchmarkTest, Division)
 	}
 }
 
+TEST_F(BenchmarkTest, Remainder)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 1000;
+	for (bi.degree = 10; bi.degree < 16; bi.degree++) {
+		Benchmark<AdditionGenerator<Coeff>, RemainderExecutor, CMP<Coeff>> bench(bi, "CArL");
+		file.push(bench.result(), bi.degree);
+	}
+}
+
 TEST_F(BenchmarkTest, Prem)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "framework/Benchmark.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/polynomialfunctions/Factorization_univariate.h"
+#include "carl/converter/CoCoAAdaptor.h"
+#include "BenchmarkTest.h"
+
+using namespace carl;
+
+namespace carl {
+
+	//##### Generator
+	/**
+	 * Creates a product of four random polynomials of the given degree.
+	 * The factors have small coefficients, hence they are most likely irreducible.
+	 */
+	template<typename C>
+	struct RandomProductGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		RandomProductGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			CUP<C> res(bi.variables[0], C(1));
+			for (std::size_t i = 0; i < 4; i++) {
+				std::vector<C> coeffs;
+				for (std::size_t d = 0; d < bi.degree; d++) coeffs.emplace_back(int(g.uniDist(19)) - 9);
+				coeffs.emplace_back(1 + g.uniDist(9));
+				res *= CUP<C>(bi.variables[0], coeffs);
+			}
+			return std::make_tuple(res);
+		}
+	};
+	/**
+	 * Creates x^(2^k) + 1 for k = bi.degree.
+	 * This polynomial is irreducible over the rationals, but splits into many factors modulo every prime.
+	 */
+	template<typename C>
+	struct CyclotomicGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		CyclotomicGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			std::vector<C> coeffs((std::size_t(1) << bi.degree) + 1, C(0));
+			coeffs.front() = 1;
+			coeffs.back() = 1;
+			return std::make_tuple(CUP<C>(bi.variables[0], coeffs));
+		}
+	};
+
+	//##### Executor
+	/**
+	 * Factorizes the polynomial and returns the number of distinct factors.
+	 */
+	struct FactorizationExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CUP<Coeff>>& args) {
+			return carl::factorization(std::get<0>(args)).size();
+		}
+	};
+	#ifdef USE_COCOA
+	struct CoCoAFactorizationExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CUP<Coeff>>& args) {
+			CMP<Coeff> p(std::get<0>(args));
+			CoCoAAdaptor<CMP<Coeff>> c({p});
+			return c.factorize(p).size();
+		}
+	};
+	#endif
+}
+
+TEST_F(BenchmarkTest, UnivariateFactorization)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 10;
+	for (bi.degree = 2; bi.degree <= 12; bi.degree += 2) {
+		Benchmark<RandomProductGenerator<mpq_class>, FactorizationExecutor, std::size_t> bench(bi, "Modular");
+		BenchmarkResult res = bench.result();
+		#ifdef USE_COCOA
+		Benchmark<RandomProductGenerator<mpq_class>, CoCoAFactorizationExecutor, std::size_t> cocoa(bi, "CoCoA");
+		BenchmarkResult other = cocoa.result();
+		res.insert(other.begin(), other.end());
+		#endif
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, CyclotomicFactorization)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 1;
+	for (bi.degree = 2; bi.degree <= 6; bi.degree++) {
+		Benchmark<CyclotomicGenerator<mpq_class>, FactorizationExecutor, std::size_t> bench(bi, "Modular");
+		BenchmarkResult res = bench.result();
+		#ifdef USE_COCOA
+		Benchmark<CyclotomicGenerator<mpq_class>, CoCoAFactorizationExecutor, std::size_t> cocoa(bi, "CoCoA");
+		BenchmarkResult other = cocoa.result();
+		res.insert(other.begin(), other.end());
+		#endif
+		file.push(res, bi.degree);
+	}
+}
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+
+#include "framework/Benchmark.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "BenchmarkTest.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace carl;
+
+namespace carl {
+
+	//##### Generator
+	/**
+	 * Creates the cyclic n-roots problem with n = bi.degree.
+	 */
+	template<typename C>
+	struct CyclicGenerator: public BaseGenerator {
+		typedef std::tuple<std::vector<CMP<C>>> type;
+		CyclicGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			return std::make_tuple(benchmarks::cyclic<C, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(bi.degree));
+		}
+	};
+	/**
+	 * Creates the katsura problem with n = bi.degree.
+	 */
+	template<typename C>
+	struct KatsuraGenerator: public BaseGenerator {
+		typedef std::tuple<std::vector<CMP<C>>> type;
+		KatsuraGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			return std::make_tuple(benchmarks::katsura<C, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(bi.degree));
+		}
+	};
+	/**
+	 * Creates bi.degree binomials of degree five to seven and 20000 terms of degree six to nine to look up divisors for.
+	 */
+	template<typename C>
+	struct DivisorLookupGenerator: public BaseGenerator {
+		typedef std::tuple<std::vector<CMP<C>>, std::vector<Term<C>>> type;
+		DivisorLookupGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		Monomial::Arg monomial(std::size_t degree) const {
+			Monomial::Arg m = createMonomial(bi.variables[g.uniDist(bi.variables.size())], 1);
+			for (std::size_t k = 1; k < degree; k++) m = m * createMonomial(bi.variables[g.uniDist(bi.variables.size())], 1);
+			return m;
+		}
+		type operator()() const {
+			std::vector<CMP<C>> generators;
+			for (std::size_t i = 0; i < bi.degree; i++) {
+				generators.emplace_back(CMP<C>({Term<C>(C(1), monomial(5 + g.uniDist(3))), Term<C>(C(1), monomial(2))}));
+			}
+			std::vector<Term<C>> terms;
+			for (std::size_t i = 0; i < 20000; i++) terms.emplace_back(C(1), monomial(6 + g.uniDist(4)));
+			return std::make_tuple(generators, terms);
+		}
+	};
+
+	//##### Executor
+	/**
+	 * Computes the Groebner basis with the given procedure and returns its size.
+	 * Threads = 0 uses all available hardware threads, but at least two.
+	 */
+	template<template<typename, template<typename> class> class Procedure, std::size_t Threads = 1>
+	struct GroebnerExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<std::vector<CMP<Coeff>>>& args) {
+			GBProcedure<CMP<Coeff>, Procedure, StdAdding> gb;
+			gb.setThreads(Threads == 0 ? std::max(2u, std::thread::hardware_concurrency()) : Threads);
+			for (const auto& p: std::get<0>(args)) gb.addPolynomial(p);
+			gb.reduceInput();
+			gb.calculate();
+			return gb.getIdeal().nrGenerators();
+		}
+	};
+	/**
+	 * Looks up divisors for all terms with the given ideal datastructure and returns the number of terms that have a divisor.
+	 */
+	template<template<typename> class Datastructure>
+	struct DivisorLookupExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<std::vector<CMP<Coeff>>, std::vector<Term<Coeff>>>& args) {
+			Ideal<CMP<Coeff>, Datastructure> ideal;
+			for (const auto& g: std::get<0>(args)) ideal.addGenerator(g);
+			std::size_t found = 0;
+			for (const auto& t: std::get<1>(args)) {
+				if (ideal.getDivisor(t).success()) found++;
+			}
+			return found;
+		}
+	};
+}
+
+TEST_F(BenchmarkTest, GroebnerCyclic)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 1;
+	for (bi.degree = 3; bi.degree <= 5; bi.degree++) {
+		BenchmarkResult res;
+		{
+			Benchmark<CyclicGenerator<mpq_class>, GroebnerExecutor<Buchberger>, std::size_t> bench(bi, "Buchberger");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<CyclicGenerator<mpq_class>, GroebnerExecutor<Buchberger, 0>, std::size_t> bench(bi, "Parallel Buchberger");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<CyclicGenerator<mpq_class>, GroebnerExecutor<F4>, std::size_t> bench(bi, "F4");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<CyclicGenerator<mpq_class>, GroebnerExecutor<MultiModular>, std::size_t> bench(bi, "MultiModular");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, GroebnerKatsura)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 1;
+	for (bi.degree = 3; bi.degree <= 5; bi.degree++) {
+		BenchmarkResult res;
+		{
+			Benchmark<KatsuraGenerator<mpq_class>, GroebnerExecutor<Buchberger>, std::size_t> bench(bi, "Buchberger");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<KatsuraGenerator<mpq_class>, GroebnerExecutor<Buchberger, 0>, std::size_t> bench(bi, "Parallel Buchberger");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<KatsuraGenerator<mpq_class>, GroebnerExecutor<F4>, std::size_t> bench(bi, "F4");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<KatsuraGenerator<mpq_class>, GroebnerExecutor<MultiModular>, std::size_t> bench(bi, "MultiModular");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, IdealDivisorLookup)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 8);
+	bi.n = 1;
+	for (bi.degree = 10; bi.degree <= 1000; bi.degree *= 10) {
+		BenchmarkResult res;
+		{
+			Benchmark<DivisorLookupGenerator<mpq_class>, DivisorLookupExecutor<IdealDatastructureVector>, std::size_t> bench(bi, "Vector");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<DivisorLookupGenerator<mpq_class>, DivisorLookupExecutor<IdealDatastructureTrie>, std::size_t> bench(bi, "Trie");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		file.push(res, bi.degree);
+	}
+}
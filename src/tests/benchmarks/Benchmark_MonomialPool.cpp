@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "framework/Benchmark.h"
+#include "carl/core/MonomialPool.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "BenchmarkTest.h"
+
+using namespace carl;
+
+namespace carl {
+
+	//##### Generator
+	struct ConcurrentMonomialGenerator: public BaseGenerator {
+		typedef std::tuple<std::size_t,std::vector<Variable>> type;
+		ConcurrentMonomialGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			std::vector<Variable> vars = bi.variables;
+			std::sort(vars.begin(), vars.end());
+			return std::make_tuple(bi.threads, vars);
+		}
+	};
+	template<typename C>
+	struct MonomialHandleGenerator: public BaseGenerator {
+		typedef std::tuple<CMP<C>,CMP<C>,CVAR> type;
+		MonomialHandleGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			CMP<C> base(1);
+			for (auto v: bi.variables) base += v;
+			CMP<C> lhs = base.pow(bi.degree);
+			CMP<C> rhs = (base + bi.variables[0] * bi.variables[1]).pow(bi.degree - 1);
+			return std::make_tuple(lhs, rhs, bi.variables[2]);
+		}
+	};
+
+	//##### Executor
+	/**
+	 * Creates a fixed number of monomials per thread, running the given number of threads concurrently.
+	 * Every thread creates the same monomials, hence the threads constantly hit the same pool entries.
+	 * As the work per thread is fixed, perfect scaling results in a constant running time.
+	 */
+	struct ConcurrentMonomialExecutor {
+		std::size_t operator()(const std::tuple<std::size_t,std::vector<Variable>>& args) {
+			const std::vector<Variable>& vars = std::get<1>(args);
+			std::vector<std::thread> threads;
+			for (std::size_t t = 0; t < std::get<0>(args); t++) {
+				threads.emplace_back([&vars](){
+					std::vector<Monomial::Arg> monomials;
+					for (std::size_t round = 0; round < 10; round++) {
+						monomials.clear();
+						for (exponent e1 = 1; e1 < 20; e1++) {
+							for (exponent e2 = 1; e2 < 20; e2++) {
+								for (std::size_t v = 0; v + 2 < vars.size(); v++) {
+									Monomial::Content c({ std::make_pair(vars[v], e1), std::make_pair(vars[v+1], e2), std::make_pair(vars[v+2], e1 + e2) });
+									monomials.push_back(createMonomial(std::move(c)));
+									monomials.push_back(monomials.back() * monomials[monomials.size() / 2]);
+								}
+							}
+						}
+					}
+				});
+			}
+			for (auto& t: threads) t.join();
+			return std::get<0>(args);
+		}
+	};
+	/**
+	 * Products and sums that are dominated by creating, copying and dropping Monomial::Arg handles.
+	 */
+	struct MonomialHandleExecutor {
+		template<typename Coeff>
+		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>,CVAR>& args) {
+			CMP<Coeff> product = std::get<0>(args) * std::get<1>(args);
+			return std::forward<const CMP<Coeff>>(product + std::get<1>(args) * std::get<2>(args));
+		}
+	};
+}
+
+TEST_F(BenchmarkTest, ConcurrentMonomialCreation)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 8);
+	bi.n = 1;
+	std::size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+#ifndef THREAD_SAFE
+	// The monomial pool may only be used from a single thread.
+	maxThreads = 1;
+#endif
+	for (bi.threads = 1; bi.threads <= maxThreads; bi.threads *= 2) {
+		Benchmark<ConcurrentMonomialGenerator, ConcurrentMonomialExecutor, std::size_t> bench(bi, "CArL");
+		file.push(bench.result(), bi.threads);
+	}
+}
+
+TEST_F(BenchmarkTest, MonomialHandles)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 5);
+	bi.n = 20;
+	for (bi.degree = 2; bi.degree < 7; bi.degree++) {
+		Benchmark<MonomialHandleGenerator<mpq_class>, MonomialHandleExecutor, CMP<mpq_class>> bench(bi, "CArL");
+		file.push(bench.result(), bi.degree);
+	}
+}
@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include "framework/Benchmark.h"
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/rootfinder/RootFinder.h"
+#include "BenchmarkTest.h"
+
+using namespace carl;
+
+namespace carl {
+
+	//##### Generator
+	/**
+	 * Creates a dense polynomial of the given degree with random coefficients.
+	 */
+	template<typename C>
+	struct DenseGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		DenseGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			std::vector<C> coeffs;
+			for (std::size_t d = 0; d < bi.degree; d++) coeffs.emplace_back(int(g.uniDist(2001)) - 1000);
+			coeffs.emplace_back(1 + g.uniDist(1000));
+			return std::make_tuple(CUP<C>(bi.variables[0], coeffs));
+		}
+	};
+
+	//##### Executor
+	/**
+	 * Isolates the real roots with the given splitting strategy and returns their number.
+	 */
+	template<rootfinder::SplittingStrategy Strategy>
+	struct RealRootsExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CUP<Coeff>>& args) {
+			return rootfinder::realRoots(std::get<0>(args), Strategy).size();
+		}
+	};
+}
+
+TEST_F(BenchmarkTest, RealRoots)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 2;
+	for (bi.degree = 20; bi.degree <= 200; bi.degree += 30) {
+		BenchmarkResult res;
+		{
+			Benchmark<DenseGenerator<mpq_class>, RealRootsExecutor<rootfinder::SplittingStrategy::DESCARTES>, std::size_t> bench(bi, "Descartes");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<DenseGenerator<mpq_class>, RealRootsExecutor<rootfinder::SplittingStrategy::ABERTH>, std::size_t> bench(bi, "Aberth");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		{
+			Benchmark<DenseGenerator<mpq_class>, RealRootsExecutor<rootfinder::SplittingStrategy::BINARYSAMPLE>, std::size_t> bench(bi, "Bisection");
+			BenchmarkResult r = bench.result();
+			res.insert(r.begin(), r.end());
+		}
+		file.push(res, bi.degree);
+	}
+}
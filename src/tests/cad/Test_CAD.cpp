@@ -293,3 +293,298 @@ TEST(CAD, Samples)
 	//std::cout << res << std::endl;
 	//EXPECT_TRUE(!res.empty());
 }
+
+TEST_F(CADTest, ParallelProjection)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.projectionThreads = 4;
+	carl::CAD<Rational> parallel(setting);
+	for (auto i: {3, 5, 8}) {
+		this->cad.addPolynomial(this->p[i], {x, y, z});
+		parallel.addPolynomial(this->p[i], {x, y, z});
+	}
+	this->cad.completeElimination();
+	parallel.completeElimination();
+	ASSERT_EQ(this->cad.getEliminationSets().size(), parallel.getEliminationSets().size());
+	for (std::size_t l = 0; l < parallel.getEliminationSets().size(); l++) {
+		EXPECT_EQ(this->cad.getEliminationSet(l).size(), parallel.getEliminationSet(l).size());
+	}
+	for (std::size_t l = 0; l + 1 < parallel.getEliminationSets().size(); l++) {
+		EXPECT_TRUE(parallel.getEliminationSet(l).emptySingleEliminationQueue());
+		EXPECT_TRUE(parallel.getEliminationSet(l).emptyPairedEliminationQueue());
+	}
+
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons({
+		Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}),
+		Constraint(this->p[5], Sign::POSITIVE, {x,y,z})
+	});
+	EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, parallel.getVariables()));
+}
+
+TEST_F(CADTest, ParallelProjectionWithBounds)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.simplifyEliminationByBounds = true;
+	carl::CAD<Rational> sequential(setting);
+	setting.projectionThreads = 4;
+	carl::CAD<Rational> parallel(setting);
+	for (auto i: {3, 5, 6, 8}) {
+		sequential.addPolynomial(this->p[i], {x, y, z});
+		parallel.addPolynomial(this->p[i], {x, y, z});
+	}
+	this->bounds[0] = Interval<Rational>(Rational(1, 2), Rational(2));
+	this->bounds[1] = Interval<Rational>(Rational(-2), Rational(2));
+	this->bounds[2] = Interval<Rational>(Rational(-2), Rational(0));
+	sequential.completeElimination(this->bounds);
+	parallel.completeElimination(this->bounds);
+	ASSERT_EQ(sequential.getEliminationSets().size(), parallel.getEliminationSets().size());
+	for (std::size_t l = 0; l < parallel.getEliminationSets().size(); l++) {
+		const auto& expected = sequential.getEliminationSet(l);
+		const auto& actual = parallel.getEliminationSet(l);
+		EXPECT_EQ(expected.size(), actual.size());
+		for (const auto& q: expected.getPolynomials()) {
+			EXPECT_EQ(1u, actual.getPolynomials().count(q)) << *q << " is missing on level " << l;
+		}
+		EXPECT_EQ(expected.emptySingleEliminationQueue(), actual.emptySingleEliminationQueue());
+		EXPECT_EQ(expected.emptyPairedEliminationQueue(), actual.emptyPairedEliminationQueue());
+	}
+}
+
+TEST_F(CADTest, LazardProjection)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.projectionType = cad::ProjectionType::Lazard;
+	carl::CAD<Rational> lazard(setting);
+	// x*z - y is nullified over x = y = 0, which is enforced by x^2 + y^2 = 0.
+	Polynomial q({Term<Rational>(x)*z, -Term<Rational>(y)});
+	for (const auto& poly: {q, this->p[4], this->p[5]}) {
+		this->cad.addPolynomial(poly, {x, y, z});
+		lazard.addPolynomial(poly, {x, y, z});
+	}
+	this->cad.completeElimination();
+	lazard.completeElimination();
+	ASSERT_EQ(this->cad.getEliminationSets().size(), lazard.getEliminationSets().size());
+	for (std::size_t l = 0; l < lazard.getEliminationSets().size(); l++) {
+		EXPECT_LE(lazard.getEliminationSet(l).size(), this->cad.getEliminationSet(l).size());
+	}
+
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons({
+		Constraint(q, Sign::ZERO, {x,y,z}),
+		Constraint(this->p[4], Sign::ZERO, {x,y,z}),
+		Constraint(this->p[5], Sign::POSITIVE, {x,y,z})
+	});
+	EXPECT_EQ(carl::cad::Answer::True, lazard.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, lazard.getVariables()));
+}
+
+TEST_F(CADTest, SingleCell)
+{
+	using MR = MultivariateRoot<Polynomial>;
+	using RAN = RealAlgebraicNumber<Rational>;
+	this->cad.addPolynomial(this->p[0], {x, y});
+	this->cad.addPolynomial(this->p[2], {x, y});
+	this->cad.prepareElimination();
+	const auto& vars = this->cad.getVariables();
+	ASSERT_EQ(2u, vars.size());
+
+	// Checks that the point satisfies all comparisons and returns how many of them are sections.
+	auto check = [&vars](const std::vector<cad::CellBound<Rational>>& cell, const RealAlgebraicPoint<Rational>& point) {
+		std::size_t sections = 0;
+		for (const auto& b: cell) {
+			std::size_t index = std::size_t(std::find(vars.begin(), vars.end(), b.variable) - vars.begin());
+			EXPECT_LT(index, vars.size());
+			MR::EvalMap m;
+			for (std::size_t i = index + 1; i < vars.size(); i++) m.emplace(vars[i], point[i]);
+			boost::optional<RAN> bound = b.root.evaluate(m);
+			EXPECT_TRUE(bool(bound));
+			if (!bound) continue;
+			switch (b.relation) {
+				case Relation::EQ: EXPECT_EQ(*bound, point[index]); sections++; break;
+				case Relation::LESS: EXPECT_LT(point[index], *bound); break;
+				case Relation::GREATER: EXPECT_LT(*bound, point[index]); break;
+				default: ADD_FAILURE() << "Unexpected relation " << b.relation;
+			}
+		}
+		return sections;
+	};
+	// Checks that the polynomials have the same sign on all grid points within the cell as on the given point and returns the number of such grid points.
+	auto invariant = [&vars](const std::vector<cad::CellBound<Rational>>& cell, const std::vector<Rational>& point, const std::vector<Polynomial>& polynomials) {
+		auto sign = [&vars](const Polynomial& p, const std::vector<Rational>& q) {
+			std::map<Variable, Rational> m;
+			for (std::size_t i = 0; i < vars.size(); i++) m.emplace(vars[i], q[i]);
+			return carl::sgn(p.evaluate(m));
+		};
+		auto contains = [&vars,&cell](const std::vector<Rational>& q) {
+			for (const auto& b: cell) {
+				std::size_t index = std::size_t(std::find(vars.begin(), vars.end(), b.variable) - vars.begin());
+				MR::EvalMap m;
+				for (std::size_t i = index + 1; i < vars.size(); i++) m.emplace(vars[i], RAN(q[i]));
+				boost::optional<RAN> bound = b.root.evaluate(m);
+				if (!bound) return false;
+				RAN value(q[index]);
+				if (b.relation == Relation::EQ && !(value == *bound)) return false;
+				if (b.relation == Relation::LESS && !(value < *bound)) return false;
+				if (b.relation == Relation::GREATER && !(*bound < value)) return false;
+			}
+			return true;
+		};
+		std::size_t inside = 0;
+		for (int i = -16; i <= 16; i++) {
+			for (int j = -16; j <= 16; j++) {
+				std::vector<Rational> q({Rational(i)/4, Rational(j)/4});
+				if (!contains(q)) continue;
+				inside++;
+				for (const auto& p: polynomials) {
+					EXPECT_EQ(sign(p, point), sign(p, q)) << p << " at " << q[0] << ", " << q[1];
+				}
+			}
+		}
+		return inside;
+	};
+	std::vector<Polynomial> polynomials({this->p[0], this->p[2]});
+
+	// The origin is within the circle and on the line x = y, hence one comparison is an equation.
+	RealAlgebraicPoint<Rational> origin({RAN(0), RAN(0)});
+	auto cell = this->cad.constructCell(origin);
+	EXPECT_EQ(3u, cell.size());
+	EXPECT_EQ(1u, check(cell, origin));
+	EXPECT_LT(1u, invariant(cell, {Rational(0), Rational(0)}, polynomials));
+
+	// A point outside of the circle and off the line.
+	RealAlgebraicPoint<Rational> outside({RAN(Rational(1)/4), RAN(3)});
+	cell = this->cad.constructCell(outside);
+	EXPECT_EQ(2u, cell.size());
+	EXPECT_EQ(0u, check(cell, outside));
+	EXPECT_LT(1u, invariant(cell, {Rational(1)/4, Rational(3)}, polynomials));
+}
+
+TEST_F(CADTest, Checkpoint)
+{
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons({Constraint(this->p[0], Sign::ZERO, {x,y})});
+	this->cad.addPolynomial(this->p[0], {x, y});
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	std::vector<std::size_t> sizes;
+	for (const auto& e: this->cad.getEliminationSets()) sizes.push_back(e.size());
+	std::size_t samples = this->cad.samples().size();
+
+	EXPECT_EQ(1u, this->cad.checkpoint());
+	this->cad.addPolynomial(this->p[2], {x, y});
+	cons.emplace_back(this->p[2], Sign::ZERO, std::vector<Variable>({x,y}));
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, this->cad.getVariables()));
+
+	EXPECT_EQ(2u, this->cad.checkpoint());
+	this->cad.addPolynomial(this->p[1], {x, y});
+	cons.emplace_back(this->p[1], Sign::ZERO, std::vector<Variable>({x,y}));
+	EXPECT_EQ(carl::cad::Answer::False, this->cad.check(cons, r, this->bounds));
+
+	this->cad.rollback();
+	cons.pop_back();
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, this->cad.getVariables()));
+
+	this->cad.rollback();
+	cons.pop_back();
+	EXPECT_EQ(0u, this->cad.checkpoints());
+	ASSERT_EQ(sizes.size(), this->cad.getEliminationSets().size());
+	for (std::size_t l = 0; l < sizes.size(); l++) {
+		EXPECT_EQ(sizes[l], this->cad.getEliminationSet(l).size());
+	}
+	EXPECT_EQ(samples, this->cad.samples().size());
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, this->cad.getVariables()));
+}
+
+TEST_F(CADTest, CheckpointRemove)
+{
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons({Constraint(this->p[0], Sign::ZERO, {x,y}), Constraint(this->p[2], Sign::ZERO, {x,y})});
+	this->cad.addPolynomial(this->p[0], {x, y});
+	this->cad.addPolynomial(this->p[2], {x, y});
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	std::vector<std::size_t> sizes;
+	for (const auto& e: this->cad.getEliminationSets()) sizes.push_back(e.size());
+	std::vector<RealAlgebraicPoint<Rational>> samples = this->cad.samples();
+
+	// A checkpoint without changes restores nothing.
+	this->cad.checkpoint();
+	this->cad.rollback();
+	EXPECT_EQ(samples.size(), this->cad.samples().size());
+
+	// Removing all polynomials erases the samples, the rollback has to restore them.
+	this->cad.checkpoint();
+	this->cad.removePolynomial(this->p[2]);
+	this->cad.removePolynomial(this->p[0]);
+	EXPECT_GT(samples.size(), this->cad.samples().size());
+	this->cad.rollback();
+
+	ASSERT_EQ(sizes.size(), this->cad.getEliminationSets().size());
+	for (std::size_t l = 0; l < sizes.size(); l++) {
+		EXPECT_EQ(sizes[l], this->cad.getEliminationSet(l).size());
+	}
+	std::vector<RealAlgebraicPoint<Rational>> restored = this->cad.samples();
+	ASSERT_EQ(samples.size(), restored.size());
+	for (std::size_t i = 0; i < samples.size(); i++) {
+		ASSERT_EQ(samples[i].dim(), restored[i].dim());
+		for (std::size_t d = 0; d < samples[i].dim(); d++) {
+			EXPECT_EQ(samples[i][d], restored[i][d]);
+		}
+	}
+	EXPECT_TRUE(this->cad.getSampleTree().isConsistent());
+	EXPECT_EQ(carl::cad::Answer::True, this->cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, this->cad.getVariables()));
+}
+
+TEST_F(CADTest, ParallelLifting)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.liftingThreads = 4;
+	RealAlgebraicPoint<Rational> r;
+	{
+		carl::CAD<Rational> parallel(setting);
+		parallel.addPolynomial(this->p[3], {x, y, z});
+		parallel.addPolynomial(this->p[4], {x, y, z});
+		parallel.addPolynomial(this->p[5], {x, y, z});
+		std::vector<Constraint> cons({
+			Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}),
+			Constraint(this->p[4], Sign::POSITIVE, {x,y,z}),
+			Constraint(this->p[5], Sign::POSITIVE, {x,y,z})
+		});
+		EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r, this->bounds));
+		for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, parallel.getVariables()));
+		EXPECT_FALSE(parallel.getLiftingStatistics().empty());
+		// the merged sample tree is used by subsequent checks
+		EXPECT_EQ(carl::cad::Answer::True, parallel.check(cons, r, this->bounds));
+		for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, parallel.getVariables()));
+	}
+	{
+		carl::CAD<Rational> parallel(setting);
+		parallel.addPolynomial(this->p[7], {x, y, z});
+		parallel.addPolynomial(this->p[8], {x, y, z});
+		std::vector<Constraint> cons({
+			Constraint(this->p[7], Sign::NEGATIVE, {x,y,z}),
+			Constraint(this->p[8], Sign::ZERO, {x,y,z})
+		});
+		EXPECT_EQ(carl::cad::Answer::False, parallel.check(cons, r, this->bounds));
+		EXPECT_TRUE(parallel.isComplete());
+		std::size_t subtrees = 0;
+		std::size_t checkedSamples = 0;
+		for (const auto& s: parallel.getLiftingStatistics()) {
+			subtrees += s.subtrees;
+			checkedSamples += s.checkedSamples;
+		}
+		EXPECT_TRUE(subtrees > 0);
+		EXPECT_EQ(parallel.samples().size(), checkedSamples);
+
+		// the complete sample tree does not depend on the lifting mode
+		this->cad.addPolynomial(this->p[7], {x, y, z});
+		this->cad.addPolynomial(this->p[8], {x, y, z});
+		this->cad.prepareElimination();
+		EXPECT_EQ(carl::cad::Answer::False, this->cad.check(cons, r, this->bounds));
+		EXPECT_EQ(this->cad.samples().size(), parallel.samples().size());
+	}
+}
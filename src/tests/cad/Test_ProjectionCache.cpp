@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+
+#include "carl/cad/CADTypes.h"
+#include "carl/cad/ProjectionCache.h"
+#include "carl/util/MemoCache.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(MemoCache, Eviction)
+{
+	MemoCache<int, int> cache(3);
+	std::size_t computed = 0;
+	auto square = [&](int i){ return [&computed,i](){ computed++; return i*i; }; };
+	auto weight = [](int, int){ return std::size_t(1); };
+
+	EXPECT_EQ(4, cache.get(2, square(2), weight));
+	EXPECT_EQ(4, cache.get(2, square(2), weight));
+	EXPECT_EQ(1u, computed);
+	EXPECT_EQ(9, cache.get(3, square(3), weight));
+	EXPECT_EQ(16, cache.get(4, square(4), weight));
+	// Touch 2, such that 3 is the least recently used entry.
+	EXPECT_EQ(4, cache.get(2, square(2), weight));
+	EXPECT_EQ(25, cache.get(5, square(5), weight));
+	EXPECT_EQ(4u, computed);
+
+	MemoCacheStatistics s = cache.statistics();
+	EXPECT_EQ(2u, s.hits);
+	EXPECT_EQ(4u, s.misses);
+	EXPECT_EQ(1u, s.evictions);
+	EXPECT_EQ(3u, s.entries);
+	EXPECT_EQ(3u, s.weight);
+
+	EXPECT_EQ(4, cache.get(2, square(2), weight));
+	EXPECT_EQ(9, cache.get(3, square(3), weight));
+	EXPECT_EQ(5u, computed);
+
+	// Entries that exceed the budget on their own are not stored.
+	EXPECT_EQ(36, cache.get(6, square(6), [](int, int){ return std::size_t(4); }));
+	EXPECT_EQ(3u, cache.statistics().entries);
+
+	cache.setBudget(1);
+	EXPECT_EQ(1u, cache.statistics().entries);
+	cache.clear();
+	EXPECT_EQ(0u, cache.statistics().entries);
+	EXPECT_EQ(0u, cache.statistics().hits);
+}
+
+TEST(MemoCache, StringKeys)
+{
+	MemoCache<std::string, std::size_t> cache(2);
+	auto length = [](const std::string& s){ return [s](){ return s.size(); }; };
+	auto weight = [](const std::string&, std::size_t){ return std::size_t(1); };
+
+	for (const auto& s: {"a", "bb", "ccc", "bb", "dddd", "a"}) {
+		EXPECT_EQ(std::string(s).size(), cache.get(s, length(s), weight));
+	}
+	MemoCacheStatistics s = cache.statistics();
+	EXPECT_EQ(1u, s.hits);
+	EXPECT_EQ(5u, s.misses);
+	EXPECT_EQ(3u, s.evictions);
+	EXPECT_EQ(2u, s.entries);
+}
+
+TEST(ProjectionCache, Projection)
+{
+	using UPoly = cad::UPolynomial<Rational>;
+	using MPoly = cad::MPolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto& cache = cad::ProjectionCache<UPoly>::getInstance();
+	cache.clear();
+
+	UPoly p(x, {MPoly(y)*y - Rational(1), MPoly(0), MPoly(1)});
+	UPoly q(x, {MPoly(-Rational(1)), MPoly(y)});
+
+	UPoly r = cache.resultant(p, q);
+	EXPECT_EQ(carl::resultant(p, q), r);
+	EXPECT_EQ(r, cache.resultant(UPoly(p), UPoly(q)));
+	EXPECT_EQ(carl::discriminant(p), cache.discriminant(p));
+	EXPECT_EQ(carl::discriminant(p), cache.discriminant(p));
+
+	EXPECT_EQ(1u, cache.resultantStatistics().hits);
+	EXPECT_EQ(1u, cache.resultantStatistics().misses);
+	EXPECT_EQ(1u, cache.discriminantStatistics().hits);
+	EXPECT_EQ(1u, cache.discriminantStatistics().misses);
+	EXPECT_GT(cache.resultantStatistics().weight, 0u);
+
+	cache.setBudget(0);
+	EXPECT_EQ(0u, cache.resultantStatistics().entries);
+	EXPECT_EQ(r, cache.resultant(p, q));
+	EXPECT_EQ(0u, cache.resultantStatistics().entries);
+	cache.setBudget(cad::ProjectionCache<UPoly>::DefaultBudget);
+	cache.clear();
+}
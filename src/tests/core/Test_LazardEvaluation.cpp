@@ -3,9 +3,44 @@
 
 #include "carl/core/polynomialfunctions/LazardEvaluation.h"
 #include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/rootfinder/RootFinder.h"
 
 #include "../Common.h"
 
+TEST(LazardEvaluation, Native)
+{
+	using Poly = carl::MultivariatePolynomial<Rational>;
+	using UPoly = carl::UnivariatePolynomial<Poly>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	carl::Interval<Rational> i(Rational(1), carl::BoundType::STRICT, Rational(2), carl::BoundType::STRICT);
+	carl::RealAlgebraicNumber<Rational> sqrt2x(carl::UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-2, 0, 1}), i);
+	carl::RealAlgebraicNumber<Rational> sqrt2y(carl::UnivariatePolynomial<Rational>(y, std::initializer_list<Rational>{-2, 0, 1}), i);
+
+	{
+		// (x - y) * z vanishes for x = y, the Lazard evaluation is -z.
+		UPoly p(z, {Poly(0), Poly(x) - y});
+		std::map<carl::Variable, carl::RealAlgebraicNumber<Rational>> m({{x, sqrt2x}, {y, sqrt2y}});
+		UPoly q = carl::lazardEvaluation(p, {x, y}, m);
+		EXPECT_EQ(UPoly(z, {Poly(0), Poly(-1)}), q);
+		auto roots = carl::rootfinder::realRoots(q, m);
+		ASSERT_TRUE(bool(roots));
+		ASSERT_EQ(1u, roots->size());
+		EXPECT_TRUE(carl::isZero(roots->front()));
+	}
+	{
+		// x * z - y vanishes for x = y = 0, the Lazard evaluation is the constant -1.
+		UPoly p(z, {-Poly(y), Poly(x)});
+		std::map<carl::Variable, carl::RealAlgebraicNumber<Rational>> m({{x, carl::RealAlgebraicNumber<Rational>(0)}, {y, carl::RealAlgebraicNumber<Rational>(0)}});
+		UPoly q = carl::lazardEvaluation(p, {x, y}, m);
+		EXPECT_EQ(UPoly(z, Poly(-1)), q);
+		// Without nullification, the polynomial is returned as is.
+		std::map<carl::Variable, carl::RealAlgebraicNumber<Rational>> m2({{x, carl::RealAlgebraicNumber<Rational>(1)}, {y, carl::RealAlgebraicNumber<Rational>(0)}});
+		EXPECT_EQ(p, carl::lazardEvaluation(p, {x, y}, m2));
+	}
+}
+
 #ifdef USE_COCOA
 TEST(LazardEvaluation, Test)
 {
@@ -248,3 +248,59 @@ TEST(Monomial, CalcLCM)
 	carl::Monomial::Arg m2 = x*x*y;
 	EXPECT_EQ(y, carl::Monomial::calcLcmAndDivideBy(m1, m2));
 }
+
+TEST(Monomial, PackedExponents)
+{
+	carl::VariablePool::getInstance().clear();
+	std::vector<carl::Variable> vars = {
+		carl::freshRealVariable("x"),
+		carl::freshIntegerVariable("i"),
+		carl::freshRealVariable("y"),
+		carl::freshRealVariable("z")
+	};
+	std::sort(vars.begin(), vars.end());
+	for (auto v: vars) {
+		EXPECT_LT(carl::PackedExponents::lane(v), carl::PackedExponents::Lanes);
+	}
+	// Reference implementations on the sparse representation.
+	auto lexicalCompare = [](const carl::Monomial::Content& lhs, const carl::Monomial::Content& rhs) {
+		auto l = lhs.begin();
+		auto r = rhs.begin();
+		for (; l != lhs.end(); ++l, ++r) {
+			if (r == rhs.end()) return carl::CompareResult::GREATER;
+			if (l->first != r->first) return (l->first < r->first) ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+			if (l->second != r->second) return (l->second > r->second) ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+		}
+		if (r == rhs.end()) return carl::CompareResult::EQUAL;
+		return carl::CompareResult::LESS;
+	};
+	auto divisible = [](const carl::Monomial::Content& lhs, const carl::Monomial::Content& rhs) {
+		for (const auto& ve: rhs) {
+			auto it = std::find(lhs.begin(), lhs.end(), ve.first);
+			if (it == lhs.end() || it->second < ve.second) return false;
+		}
+		return true;
+	};
+
+	std::vector<carl::Monomial::Arg> monomials;
+	for (carl::exponent e = 0; e < 81; e++) {
+		carl::Monomial::Content c;
+		carl::exponent rest = e;
+		for (auto v: vars) {
+			if (rest % 3 > 0) c.emplace_back(v, rest % 3);
+			rest /= 3;
+		}
+		if (c.empty()) continue;
+		monomials.push_back(carl::createMonomial(std::move(c)));
+		EXPECT_TRUE(monomials.back()->packed().valid());
+	}
+	for (const auto& m1: monomials) {
+		for (const auto& m2: monomials) {
+			EXPECT_EQ(lexicalCompare(m1->exponents(), m2->exponents()), carl::Monomial::lexicalCompare(*m1, *m2));
+			EXPECT_EQ(divisible(m1->exponents(), m2->exponents()), m1->divisible(m2));
+		}
+	}
+
+	auto m = carl::createMonomial(vars[0], carl::PackedExponents::MaxExponent + 1);
+	EXPECT_FALSE(m->packed().valid());
+}
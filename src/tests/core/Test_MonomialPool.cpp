@@ -2,6 +2,9 @@
 
 #include "carl/core/MonomialPool.h"
 
+#include <set>
+#include <thread>
+
 using namespace carl;
 
 TEST(MonomialPool, singleton)
@@ -29,3 +32,70 @@ TEST(MonomialPool, clear)
 	auto m = createMonomial(x, 3);
 	EXPECT_EQ(pool.size(), 1);
 }
+
+TEST(MonomialPool, release)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+	std::size_t size = pool.size();
+	{
+		auto m1 = createMonomial(x, 5);
+		EXPECT_EQ(pool.size(), size + 1);
+		auto m2 = m1;
+		m1 = nullptr;
+		EXPECT_EQ(pool.size(), size + 1);
+		EXPECT_EQ(m2.get(), createMonomial(x, 5).get());
+	}
+	EXPECT_EQ(pool.size(), size);
+}
+
+TEST(MonomialPool, uniqueIDs)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Monomial::Arg> monomials;
+	std::set<std::size_t> ids;
+	for (exponent i = 1; i < 50; i++) {
+		for (exponent j = 1; j < 10; j++) {
+			monomials.push_back(createMonomial(Monomial::Content({std::make_pair(x, i), std::make_pair(y, j)})));
+			EXPECT_NE(monomials.back()->id(), 0);
+			EXPECT_LE(monomials.back()->id(), pool.largestID());
+			ids.insert(monomials.back()->id());
+		}
+	}
+	EXPECT_EQ(ids.size(), monomials.size());
+	for (const auto& m: monomials) {
+		EXPECT_EQ(m.get(), createMonomial(Monomial::Content(m->exponents())).get());
+	}
+}
+
+#ifdef THREAD_SAFE
+TEST(MonomialPool, concurrentCreation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::size_t threadCount = 4;
+	std::vector<std::vector<Monomial::Arg>> results(threadCount);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < threadCount; t++) {
+		threads.emplace_back([&results,t,x,y](){
+			for (std::size_t round = 0; round < 20; round++) {
+				results[t].clear();
+				for (exponent i = 1; i < 30; i++) {
+					for (exponent j = 1; j < 30; j++) {
+						results[t].push_back(createMonomial(Monomial::Content({std::make_pair(x, i), std::make_pair(y, j)})));
+					}
+				}
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	for (std::size_t t = 1; t < threadCount; t++) {
+		ASSERT_EQ(results[0].size(), results[t].size());
+		for (std::size_t i = 0; i < results[0].size(); i++) {
+			EXPECT_EQ(results[0][i].get(), results[t][i].get());
+		}
+	}
+}
+#endif
@@ -43,3 +43,27 @@ TEST(MultivariateGCD, test1)
     P h2({(Rational)1*y});
     EXPECT_EQ( carl::gcd( h1, h2 ), h2 );
 }
+
+TEST(MultivariateGCD, Modular)
+{
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+    typedef MultivariatePolynomial<Rational> P;
+    P px(x), py(y), pz(z);
+
+    // The result has coprime integral coefficients and a positive leading coefficient.
+    EXPECT_EQ(px + py, carl::gcd((px + py) * (px - pz), (px + py) * (py + pz)));
+    EXPECT_EQ(P(1), carl::gcd(px * py + Rational(1), px + py));
+    EXPECT_EQ((px * py - Rational(2)).coprimeCoefficients(), carl::gcd((px * py - Rational(2)) * Rational(3), (Rational(2) - px * py) * (px + Rational(1))));
+    EXPECT_EQ((px * px - py).coprimeCoefficients(), carl::gcd((px * px - py) * (px - py), (px * px - py) * (px * px + py)));
+    EXPECT_EQ(px.coprimeCoefficients(), carl::gcd(px * px * py, px * pz + px));
+
+    // Contents with respect to the eliminated variables and large coefficients.
+    P f = Rational(1000003) * px * px * pz + Rational(99991) * py * pz * pz - Rational(7, 3);
+    P g = pz * pz + Rational(65537) * px * py;
+    P h = (px + Rational(2)) * (pz - py);
+    EXPECT_EQ((f * g).coprimeCoefficients(), carl::gcd(f * g * h, f * g * (h + Rational(1))));
+    EXPECT_EQ((f * h).coprimeCoefficients(), carl::gcd(f * f * h, g * f * h));
+    EXPECT_EQ(g.coprimeCoefficients(), carl::gcd(g.pow(3), g * (f + px)));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "carl/core/MultivariateHensel.h"
+#include "carl/core/polynomialfunctions/Factorization.h"
 #include "carl/core/VariablePool.h"
 #include "carl/util/platform.h"
 
@@ -25,3 +26,64 @@ TEST(Diophantine, Constructor)
 	std::cout << result.back() << std::endl;
 }
 */
+
+TEST(MultivariateHensel, Lift)
+{
+	typedef MultivariatePolynomial<mpq_class> Poly;
+	typedef MultivariateHensel<mpq_class, GrLexOrdering, StdMultivariatePolynomialPolicies<>> Hensel;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly px(x), py(y), pz(z);
+	Poly g = py * px * px + pz * px - mpq_class(3);
+	Poly h = (pz + mpq_class(1)) * px + py * py;
+	Poly f = g * h;
+	std::map<Variable, mpq_class> point = {{y, mpq_class(2)}, {z, mpq_class(1)}};
+	Poly G, H;
+	EXPECT_TRUE(Hensel::lift(f, x, point, g.substitute(point).toUnivariatePolynomial(), h.substitute(point).toUnivariatePolynomial(), G, H));
+	EXPECT_EQ(f * f.lcoeff(x), G * H);
+	EXPECT_EQ(f.lcoeff(x), G.lcoeff(x));
+	EXPECT_EQ(f.lcoeff(x), H.lcoeff(x));
+	Poly quotient;
+	EXPECT_TRUE(G.divideBy(g, quotient));
+	EXPECT_TRUE(H.divideBy(h, quotient));
+
+	// x^2 - y is irreducible, but splits at y = 4.
+	Poly irreducible = px * px - py;
+	std::map<Variable, mpq_class> square = {{y, mpq_class(4)}};
+	UnivariatePolynomial<mpq_class> g2(x, {mpq_class(-2), mpq_class(1)});
+	UnivariatePolynomial<mpq_class> h2(x, {mpq_class(2), mpq_class(1)});
+	EXPECT_FALSE(Hensel::lift(irreducible, x, square, g2, h2, G, H));
+}
+
+TEST(MultivariateHensel, Factorization)
+{
+	typedef MultivariatePolynomial<mpq_class> Poly;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly px(x), py(y), pz(z);
+	auto check = [](const Poly& p, std::size_t expected) {
+		auto factors = carl::factorization(p);
+		Poly product(1);
+		std::size_t count = 0;
+		for (const auto& f: factors) {
+			product *= f.first.pow(f.second);
+			if (!f.first.isConstant()) count += f.second;
+		}
+		EXPECT_EQ(p, product);
+		EXPECT_EQ(expected, count);
+	};
+	check(px * px - py * py, 2);
+	check(px * px - py, 1);
+	check(px * px * py * py - mpq_class(4), 2);
+	check((px * py + pz) * (px - py * pz + mpq_class(1)) * mpq_class(3, 2), 2);
+	check((px + py).pow(3) * (px * px + py * py + mpq_class(1)), 4);
+	// Content with respect to the main variable and leading coefficients that vanish.
+	check((py * py - mpq_class(1)) * (py * px * px + px + pz) * (pz * px - py), 4);
+	check((px * py * pz - mpq_class(1)) * (px * px * pz + py - mpq_class(7)) * (px + py + pz).pow(2), 4);
+	// Images with more factors than the polynomial.
+	check(px.pow(4) + py.pow(4), 1);
+	check((px.pow(4) - mpq_class(10) * px * px * py + py * py) * (px * px - py * pz), 2);
+	EXPECT_EQ(std::size_t(3), carl::irreducibleFactors(px * px * py - py * pz * pz, false).size());
+}
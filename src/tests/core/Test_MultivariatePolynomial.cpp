@@ -682,3 +682,43 @@ TEST(MultivariatePolynomialTest, Definiteness)
                                          (Rational)100000*z*z});
     EXPECT_TRUE(p5.definiteness() == Definiteness::POSITIVE_SEMI);
 }
+
+TEST(MultivariatePolynomial, HeapArithmetic)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly f = (Poly(x) + y + z + Rational(1)).pow(4);
+	Poly g = (Poly(x) * x - Rational(2) * y + z * x + Rational(3)).pow(3);
+
+	// Compare against a product that is accumulated term by term.
+	Poly expected;
+	for (const auto& t: g) expected += f * t;
+	f.makeOrdered();
+	g.makeOrdered();
+	Poly::TermsType terms;
+	heapMultiply<Poly::OrderedBy>(f.getTerms(), g.getTerms(), terms);
+	EXPECT_EQ(expected, Poly(std::move(terms), false, true));
+	EXPECT_EQ(expected, f * g);
+	EXPECT_EQ(expected, g * f);
+	EXPECT_TRUE((f * (-f) + f.pow(2)).isZero());
+
+	// Exact division.
+	Poly quotient;
+	EXPECT_TRUE(expected.divideBy(g, quotient));
+	EXPECT_EQ(f, quotient);
+	EXPECT_EQ(g, expected.quotient(f));
+	EXPECT_FALSE((expected + x).divideBy(g, quotient));
+
+	// Division with remainder.
+	Poly r = Poly(x) * y * y + z - Rational(5);
+	Poly p = expected + r;
+	auto res = p.divideBy(g);
+	EXPECT_EQ(p, res.quotient * g + res.remainder);
+	EXPECT_EQ(res.remainder, p.remainder(g));
+	for (const auto& t: res.remainder) {
+		EXPECT_FALSE(t.divisible(g.lterm()));
+	}
+	EXPECT_TRUE(expected.remainder(f).isZero());
+}
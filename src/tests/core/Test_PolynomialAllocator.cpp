@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+
+#include "../Common.h"
+
+#include <thread>
+
+using namespace carl;
+
+template<typename Allocator>
+using PolyWith = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, Allocator>>;
+
+TEST(PolynomialAllocator, BumpArena)
+{
+	std::vector<void*> blocks;
+	for (std::size_t i = 1; i < 1000; i++) {
+		void* p = BumpArena::allocate(i);
+		EXPECT_EQ(std::size_t(0), reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t));
+		blocks.push_back(p);
+	}
+	// Large allocations get a chunk of their own.
+	blocks.push_back(BumpArena::allocate(BumpArena::ChunkSize * 2));
+	for (auto p: blocks) BumpArena::deallocate(p);
+	// Memory may be freed by another thread.
+	void* p = BumpArena::allocate(100);
+	std::thread t([p](){ BumpArena::deallocate(p); });
+	t.join();
+
+	std::vector<int, BumpArenaAllocator<int>> v;
+	for (int i = 0; i < 100000; i++) v.push_back(i);
+	EXPECT_EQ(99999, v.back());
+}
+
+TEST(PolynomialAllocator, SizeClassPool)
+{
+	void* p1 = SizeClassPool::allocate(20);
+	SizeClassPool::deallocate(p1, 20);
+	// Blocks of the same size class are reused.
+	void* p2 = SizeClassPool::allocate(30);
+	EXPECT_EQ(p1, p2);
+	SizeClassPool::deallocate(p2, 30);
+	void* p3 = SizeClassPool::allocate(SizeClassPool::MinBlockSize << SizeClassPool::NumClasses);
+	SizeClassPool::deallocate(p3, SizeClassPool::MinBlockSize << SizeClassPool::NumClasses);
+
+	std::vector<int, SizeClassPoolAllocator<int>> v;
+	for (int i = 0; i < 100000; i++) v.push_back(i);
+	EXPECT_EQ(99999, v.back());
+}
+
+template<typename T>
+class PolynomialAllocatorTest: public testing::Test {};
+
+using AllocatorPolicies = ::testing::Types<NoAllocator, ArenaAllocator, PoolAllocator>;
+TYPED_TEST_CASE(PolynomialAllocatorTest, AllocatorPolicies);
+
+TYPED_TEST(PolynomialAllocatorTest, Operations)
+{
+	using Poly = PolyWith<TypeParam>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = (Poly(x) + y + Rational(1)).pow(5);
+	Poly q = Poly(x) * y - Rational(2);
+	Poly prod = p * q;
+	EXPECT_EQ(p, prod.quotient(q));
+	EXPECT_TRUE(prod.remainder(q).isZero());
+	Poly s = prod.substitute(x, Poly(y) + Rational(1));
+	EXPECT_FALSE(s.has(x));
+	MultivariatePolynomial<Rational> ref = MultivariatePolynomial<Rational>(prod).substitute(x, MultivariatePolynomial<Rational>(y) + Rational(1));
+	EXPECT_EQ(ref, MultivariatePolynomial<Rational>(s));
+
+	auto res = carl::resultant(p.toUnivariatePolynomial(x), q.toUnivariatePolynomial(x));
+	EXPECT_FALSE(res.isZero());
+	auto gcd = carl::gcd(prod, q);
+	EXPECT_EQ(q.normalize(), gcd.normalize());
+
+	// Polynomials may be used and destroyed in different threads.
+	Poly r;
+	std::thread t([&](){ r = p * p; prod = Poly(); });
+	t.join();
+	EXPECT_EQ(p.pow(2), r);
+}
@@ -67,3 +67,54 @@ TEST(RealAlgebraicNumber, Evaluation2)
 	auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
 	std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, Refinement)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 1});
+	UnivariatePolynomial<Rational> q(x, {Rational(-2000001, 1000000), Rational(0), Rational(1)});
+	Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	auto& refinement = ran::Refinement::getInstance();
+
+	std::map<RealAlgebraicNumberSettings::RefinementStrategy, Rational> diameters;
+	for (auto strategy: {RealAlgebraicNumberSettings::RefinementStrategy::BINARYSAMPLE, RealAlgebraicNumberSettings::RefinementStrategy::QIR}) {
+		refinement.resetCounters();
+		RealAlgebraicNumber<Rational> a(p, i);
+		for (std::size_t n = 0; n < 8; n++) a.refine(strategy);
+		ASSERT_TRUE(a.isInterval());
+		EXPECT_TRUE(a.lower() * a.lower() < 2 && a.upper() * a.upper() > 2);
+		EXPECT_EQ(std::size_t(8), refinement.bisections + refinement.secantSteps);
+		diameters[strategy] = a.getInterval().diameter();
+
+		RealAlgebraicNumber<Rational> b(q, i);
+		EXPECT_TRUE(a < b);
+		EXPECT_FALSE(b < a);
+		EXPECT_FALSE(a == b);
+	}
+	EXPECT_LT(diameters[RealAlgebraicNumberSettings::RefinementStrategy::QIR] * 1000000, diameters[RealAlgebraicNumberSettings::RefinementStrategy::BINARYSAMPLE]);
+	EXPECT_LT(std::size_t(0), refinement.secantSteps);
+}
+
+TEST(RealAlgebraicNumber, EvaluateSign)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> px(x);
+	MultivariatePolynomial<Rational> py(y);
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 1});
+	Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RealAlgebraicNumberEvaluation::RANMap<Rational> m;
+	m.emplace(x, RealAlgebraicNumber<Rational>(p, i));
+	m.emplace(y, RealAlgebraicNumber<Rational>(Rational(3, 2)));
+
+	auto& statistics = RealAlgebraicNumberEvaluation::SignStatistics::getInstance();
+	statistics.reset();
+	EXPECT_EQ(Sign::POSITIVE, RealAlgebraicNumberEvaluation::evaluateSign(py - Rational(1), m));
+	EXPECT_EQ(std::size_t(1), statistics.numeric);
+	EXPECT_EQ(Sign::NEGATIVE, RealAlgebraicNumberEvaluation::evaluateSign(px - py, m));
+	EXPECT_EQ(Sign::POSITIVE, RealAlgebraicNumberEvaluation::evaluateSign(px * py - Rational(2), m));
+	EXPECT_EQ(std::size_t(2), statistics.interval + statistics.refined);
+	EXPECT_EQ(Sign::ZERO, RealAlgebraicNumberEvaluation::evaluateSign(px * px - Rational(2), m));
+	EXPECT_EQ(std::size_t(1), statistics.exact);
+	EXPECT_EQ(Sign::POSITIVE, RealAlgebraicNumberEvaluation::evaluateSign(px * px - Rational(1999, 1000), m));
+}
@@ -42,3 +42,39 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Modular)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	using UPoly = UnivariatePolynomial<Poly>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly py(y);
+	Poly pz(z);
+
+	// p1 = x - y, p2 = x^2 + y^2 - 1, p3 = x^2 - 1
+	UPoly p1(x, {-py, Poly(1)});
+	UPoly p2(x, {py*py - Rational(1), Poly(0), Poly(1)});
+	UPoly p3(x, {Poly(-1), Poly(0), Poly(1)});
+	EXPECT_EQ(UPoly(x, py*py*Rational(2) - Rational(1)), carl::resultant(p1, p2, SubresultantStrategy::Modular));
+	EXPECT_EQ(UPoly(x, py*py - Rational(1)), carl::resultant(p3, p1, SubresultantStrategy::Modular));
+	EXPECT_EQ(UPoly(x, py*py*py*py), carl::resultant(p2, p3, SubresultantStrategy::Modular));
+	// Common factors yield a zero resultant, constant polynomials are handled as by the other strategies.
+	EXPECT_TRUE(carl::resultant(p1 * p2, p1 * p3, SubresultantStrategy::Modular).isZero());
+	EXPECT_EQ(carl::resultant(p2, UPoly(x, Poly(3)), SubresultantStrategy::Lazard), carl::resultant(p2, UPoly(x, Poly(3)), SubresultantStrategy::Modular));
+
+	// Large and fractional coefficients require several primes.
+	std::vector<UPoly> polys = {
+		UPoly(x, {py * Rational(1000003) - Rational(99991, 7), pz * py, Poly(1)}).pow(2),
+		UPoly(x, {pz.pow(3) - Rational(1, 2), py * pz + Rational(123456789), Poly(0), py * Rational(3) + Rational(5)}),
+		UPoly(x, {py.pow(4) - pz * Rational(17), (py + pz).pow(3), Poly(Rational(-2, 3)), py - pz}),
+		UPoly(x, {Poly(7), py, Poly(0), Poly(0), Poly(0), Poly(1)})
+	};
+	for (const auto& p: polys) {
+		for (const auto& q: polys) {
+			EXPECT_EQ(carl::resultant(p, q, SubresultantStrategy::Lazard), carl::resultant(p, q, SubresultantStrategy::Modular));
+		}
+		EXPECT_EQ(carl::discriminant(p, SubresultantStrategy::Lazard), carl::discriminant(p, SubresultantStrategy::Modular));
+	}
+}
@@ -3,6 +3,7 @@
 #include <carl/core/rootfinder/RootFinder.h>
 #include <carl/core/UnivariatePolynomial.h>
 #include <carl/core/polynomialfunctions/Chebyshev.h>
+#include <carl/core/polynomialfunctions/TaylorShift.h>
 
 #include "../Common.h"
 
@@ -21,6 +22,27 @@ bool represents(const carl::RealAlgebraicNumber<Number> root, const Number& exac
 	}
 }
 
+/// Collects the roots that a single splitting strategy call adds, without queueing further intervals.
+class RootCollector: public rootfinder::RootFinder<Rational> {
+	UPolynomial mPolynomial;
+public:
+	std::vector<Interval<Rational>> roots;
+	explicit RootCollector(const UPolynomial& p): mPolynomial(p) {}
+	const UPolynomial& getPolynomial() const override {
+		return mPolynomial;
+	}
+	void addQueue(const Interval<Rational>& interval, rootfinder::SplittingStrategy) override {
+		ADD_FAILURE() << "Unexpected queue item " << interval;
+	}
+	void addRoot(const RealAlgebraicNumber<Rational>& root, bool) override {
+		if (root.isNumeric()) roots.emplace_back(root.value());
+		else roots.push_back(root.getInterval());
+	}
+	void addRoot(const Interval<Rational>& interval) override {
+		roots.push_back(interval);
+	}
+};
+
 TEST(RootFinder, realRoots)
 {
 	carl::Variable x = freshRealVariable("x");
@@ -106,3 +128,90 @@ TEST(RootFinder, Chebyshev)
 		EXPECT_TRUE(mone <= r && r <= pone);
 	}
 }
+
+TEST(RootFinder, TaylorShift)
+{
+	std::vector<mpz_class> p;
+	for (int i = 0; i < 150; i++) p.emplace_back((i * 7919) % 201 - 100);
+	for (const mpz_class& a: {mpz_class(1), mpz_class(-3)}) {
+		std::vector<mpz_class> classical = p;
+		carl::taylor_shift::classical(classical, a);
+		std::vector<mpz_class> fast = p;
+		carl::taylorShift(fast, a);
+		EXPECT_EQ(classical, fast);
+	}
+	std::vector<mpz_class> small = {1, 2, 1};
+	carl::taylorShift(small, mpz_class(-1));
+	EXPECT_EQ(std::vector<mpz_class>({0, 0, 1}), small);
+}
+
+TEST(RootFinder, Descartes)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial linear(x, {Rational(0), Rational(1)});
+	std::vector<UPolynomial> inputs = {
+		carl::Chebyshev<Rational>(x)(40),
+		// Rational roots that are hit by the bisection.
+		(linear - Rational(1)) * (linear - Rational(2)) * (linear + Rational(1, 2)) * (linear * linear - Rational(2)) * (linear - Rational(3, 4)),
+		// Roots that are very close to each other.
+		(linear - Rational(1, 1000)) * (linear - Rational(2, 1000)) * (linear * linear * linear - Rational(7)) * (linear * linear + Rational(1)),
+	};
+	for (const auto& p: inputs) {
+		auto reference = rootfinder::realRoots(p, rootfinder::SplittingStrategy::BINARYSAMPLE);
+		auto roots = rootfinder::realRoots(p, rootfinder::SplittingStrategy::DESCARTES);
+		ASSERT_EQ(reference.size(), roots.size());
+		for (std::size_t i = 0; i < roots.size(); i++) {
+			EXPECT_TRUE(reference[i] == roots[i]);
+		}
+		// Integer and rational arithmetic perform the same bisections.
+		Rational bound = carl::cauchyBound(p) + 1;
+		Interval<Rational> interval(-bound, BoundType::STRICT, bound, BoundType::STRICT);
+		RootCollector integer(p);
+		RootCollector rational(p);
+		rootfinder::splitting_strategies::DescartesStrategy<Rational, true>::getInstance()(interval, integer);
+		rootfinder::splitting_strategies::DescartesStrategy<Rational, false>::getInstance()(interval, rational);
+		EXPECT_EQ(reference.size(), integer.roots.size());
+		EXPECT_EQ(integer.roots, rational.roots);
+	}
+	Interval<Rational> interval(Rational(0), BoundType::STRICT, Rational(2), BoundType::WEAK);
+	EXPECT_EQ(std::size_t(4), rootfinder::realRoots(inputs[1], interval, rootfinder::SplittingStrategy::DESCARTES).size());
+}
+
+TEST(RootFinder, Aberth)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial linear(x, {Rational(0), Rational(1)});
+	std::vector<UPolynomial> inputs = {
+		carl::Chebyshev<Rational>(x)(40),
+		(linear - Rational(1)) * (linear - Rational(2)) * (linear + Rational(1, 2)) * (linear * linear - Rational(2)) * (linear - Rational(3, 4)),
+		// Roots that are too close to each other to be separated in double precision.
+		(linear - Rational(1, 1000)) * (linear - Rational(1000000000000001, 1000000000000000000)) * (linear * linear * linear - Rational(7)) * (linear * linear + Rational(1)),
+		// A cluster of five roots within 4*10^-6, the approximations converge slowly and the inclusion discs overlap.
+		(linear - Rational(1)) * (linear - Rational(1000001, 1000000)) * (linear - Rational(1000002, 1000000)) * (linear - Rational(1000003, 1000000)) * (linear - Rational(1000004, 1000000)),
+		// A near-double root: the roots 1 +- 10^-10 are separated by less than the accuracy of the approximation.
+		(linear - Rational(1)) * (linear - Rational(1)) - Rational(1, 100000000) * Rational(1, 1000000000000),
+		// A complex pair close to the real axis, whose approximations may have a tiny imaginary part.
+		((linear - Rational(1)) * (linear - Rational(1)) + Rational(1, 1000000000000)) * (linear - Rational(2)),
+	};
+	std::vector<std::size_t> expected = {40, 6, 3, 5, 2, 1};
+	UPolynomial wilkinson(x, Rational(1));
+	for (int i = 1; i <= 20; i++) wilkinson *= linear - Rational(i);
+	// Wilkinson's polynomial, whose roots are very sensitive to perturbations of the coefficients.
+	inputs.push_back(wilkinson);
+	expected.push_back(20);
+	for (std::size_t n = 0; n < inputs.size(); n++) {
+		auto reference = rootfinder::realRoots(inputs[n], rootfinder::SplittingStrategy::BINARYSAMPLE);
+		auto roots = rootfinder::realRoots(inputs[n], rootfinder::SplittingStrategy::ABERTH);
+		EXPECT_EQ(expected[n], roots.size());
+		ASSERT_EQ(reference.size(), roots.size());
+		for (std::size_t i = 0; i < roots.size(); i++) {
+			EXPECT_TRUE(reference[i] == roots[i]);
+		}
+	}
+	auto roots = rootfinder::realRoots(wilkinson, rootfinder::SplittingStrategy::ABERTH);
+	for (std::size_t i = 0; i < roots.size(); i++) {
+		EXPECT_TRUE(represents(roots[i], Rational(i + 1)));
+	}
+	Interval<Rational> interval(Rational(0), BoundType::STRICT, Rational(2), BoundType::WEAK);
+	EXPECT_EQ(std::size_t(4), rootfinder::realRoots(inputs[1], interval, rootfinder::SplittingStrategy::ABERTH).size());
+}
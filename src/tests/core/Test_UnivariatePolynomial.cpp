@@ -265,6 +265,45 @@ TEST(UnivariatePolynomial, factorization)
     EXPECT_EQ(pol6, productOfFactors);
 }
 
+TEST(UnivariatePolynomial, modularFactorization)
+{
+	Variable x = freshRealVariable("x");
+	using UPoly = UnivariatePolynomial<Rational>;
+	UPoly quaA(x, {-2, 0, 1});
+	UPoly quaB(x, {-3, 0, 1});
+	UPoly linA(x, {5, 3});
+	// x^4 + 1 and x^4 - 10x^2 + 1 are irreducible, but split modulo every prime.
+	UPoly quartA(x, {1, 0, 0, 0, 1});
+	UPoly quartB(x, {1, 0, -10, 0, 1});
+	UPoly cubic(x, {-7, 2, 0, 1000003});
+
+	std::vector<std::pair<UPoly, std::size_t>> cases = {
+		{quartA, 1}, {quartB, 1}, {cubic, 1},
+		{quaA * quaB, 2},
+		{quaA * quaB * quartA * linA, 4},
+		{quartA * quartB * cubic, 3},
+		{quaA * quaA * quartB * Rational(2, 3), 2},
+	};
+	for (const auto& c: cases) {
+		auto factors = carl::factorization(c.first);
+		UPoly product(x, Rational(1));
+		std::size_t nonconstant = 0;
+		for (const auto& f: factors) {
+			if (!f.first.isConstant()) nonconstant++;
+			for (carl::uint i = 0; i < f.second; i++) product *= f.first;
+		}
+		EXPECT_EQ(c.first, product);
+		EXPECT_EQ(c.second, nonconstant);
+	}
+
+	// Irreducible factors of a square-free polynomial.
+	auto factors = modular_factorization::factor(quaA * quartB * linA * cubic);
+	EXPECT_EQ(std::size_t(4), factors.size());
+	for (const auto& f: {quaA, quartB, linA, cubic}) {
+		EXPECT_TRUE(std::find(factors.begin(), factors.end(), f) != factors.end());
+	}
+}
+
 TEST(UnivariatePolynomial, isNumber)
 {
 	Variable x = freshRealVariable("x");
@@ -0,0 +1,69 @@
+/**
+ * @file GroebnerUtil.h
+ *
+ * Helpers shared by the tests of the different Groebner basis procedures.
+ */
+
+#pragma once
+
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+#include "carl/groebner/groebner.h"
+
+#include "../Common.h"
+
+#include <algorithm>
+#include <vector>
+
+/// Polynomials that keep track of the input polynomials they stem from.
+template<typename Coeff>
+using PolynomialWithReasonSet = carl::MultivariatePolynomial<Coeff, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<carl::BVReasons, carl::NoAllocator>>;
+
+/**
+ * Computes the reduced Groebner basis with the given procedure.
+ * The basis is sorted by leading terms, hence bases computed by different procedures can be compared directly.
+ */
+template<typename Poly, template<typename, template<typename> class> class Procedure>
+std::vector<Poly> basis(const std::vector<Poly>& input, std::size_t threads = 1)
+{
+	carl::GBProcedure<Poly, Procedure, carl::StdAdding> gb;
+	gb.setThreads(threads);
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	std::vector<Poly> res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), Poly::compareByLeadingTerm);
+	return res;
+}
+
+/**
+ * Checks that every basis polynomial has a reason and that a polynomial that was not added yet is no reason.
+ */
+template<template<typename, template<typename> class> class Procedure>
+void checkReasonSets(std::size_t threads = 1)
+{
+	using MP = carl::MultivariatePolynomial<Rational>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+
+	PolynomialWithReasonSet<Rational> f1(MP({(Rational)1*x*x*x, (Rational)-2*x*y}));
+	PolynomialWithReasonSet<Rational> f2(MP({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x}));
+	PolynomialWithReasonSet<Rational> f3(MP({(Rational)1*y*y*y, (Rational)-1*x}));
+	f1.setReasons(carl::BitVector(0));
+	f2.setReasons(carl::BitVector(1));
+	f3.setReasons(carl::BitVector(2));
+	carl::GBProcedure<PolynomialWithReasonSet<Rational>, Procedure, carl::StdAdding> gbobject;
+	gbobject.setThreads(threads);
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	for (const auto& p: gbobject.getBasisPolynomials()) {
+		EXPECT_FALSE(p.getReasons().empty());
+		EXPECT_FALSE(p.getReasons().getBit(2));
+	}
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	for (const auto& p: gbobject.getBasisPolynomials()) {
+		EXPECT_FALSE(p.getReasons().empty());
+	}
+}
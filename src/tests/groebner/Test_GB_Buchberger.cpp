@@ -3,17 +3,16 @@
 
 #include "carl/groebner/Ideal.h"
 #include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
 #include "carl/util/platform.h"
 
 #include "../Common.h"
+#include "GroebnerUtil.h"
 
 
 using namespace carl;
 
-template<typename Coeff>
-using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
-
-
 TEST(GB_Buchberger, T1)
 {
 	Variable x = freshRealVariable("x");
@@ -76,3 +75,28 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+TEST(GB_Buchberger, Parallel)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	BuchbergerStats::getInstance()->resetWorkerStatistics();
+	for (unsigned i = 2; i <= 5; i++) {
+		auto input = benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ((basis<Poly, Buchberger>(input)), (basis<Poly, Buchberger>(input, 4)));
+	}
+	for (unsigned i = 2; i <= 5; i++) {
+		auto input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ((basis<Poly, Buchberger>(input)), (basis<Poly, Buchberger>(input, 4)));
+	}
+#ifdef THREAD_SAFE
+	// How the reductions are distributed over the workers depends on the scheduling.
+	std::size_t reductions = 0;
+	for (const auto& s: BuchbergerStats::getInstance()->getWorkerStatistics()) reductions += s.reductions;
+	EXPECT_LT(0u, reductions);
+#endif
+}
+
+TEST(GB_Buchberger, ParallelReasonSets)
+{
+	checkReasonSets<Buchberger>(2);
+}
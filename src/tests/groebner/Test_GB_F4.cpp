@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/numbers/GFNumber.h"
+
+#include "GroebnerUtil.h"
+
+using namespace carl;
+
+/**
+ * Checks the basis of x^3 - 2xy and x^2y - 2y^2 + x, which is x^2, xy, y^2 - x/2, and the basis of its real radical, which is x, y.
+ */
+template<typename Poly, template<typename, template<typename> class> class Procedure>
+void checkT1()
+{
+	using MP = carl::MultivariatePolynomial<Rational>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+
+	Poly f1(MP({(Rational)1*x*x*x, (Rational)-2*x*y}));
+	Poly f2(MP({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x}));
+	Poly F1(MP({(Rational)1*x*x}));
+	Poly F2(MP({(Rational)1*y*y, Rational(-1, 2)*x}));
+	Poly F3(MP({(Rational)1*x*y}));
+	carl::GBProcedure<Poly, Procedure, carl::StdAdding> gbobject;
+	EXPECT_TRUE(gbobject.inputEmpty());
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.reduceInput();
+	EXPECT_FALSE(gbobject.inputEmpty());
+	gbobject.calculate();
+	ASSERT_EQ(3u, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1, gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3, gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2, gbobject.getIdeal().getGenerator(2));
+
+	carl::GBProcedure<Poly, Procedure, carl::RealRadicalAwareAdding> gb2object;
+	EXPECT_TRUE(gb2object.inputEmpty());
+	gb2object.addPolynomial(f1);
+	gb2object.addPolynomial(f2);
+	EXPECT_FALSE(gb2object.inputEmpty());
+	gb2object.calculate();
+	ASSERT_EQ(2u, gb2object.getIdeal().nrGenerators());
+	EXPECT_EQ(Poly(MP(x)), gb2object.getIdeal().getGenerator(0));
+	EXPECT_EQ(Poly(MP(y)), gb2object.getIdeal().getGenerator(1));
+}
+
+TEST(GB_F4, T1)
+{
+	checkT1<MultivariatePolynomial<Rational>, F4>();
+	checkT1<PolynomialWithReasonSet<Rational>, F4>();
+}
+
+TEST(GB_F4, ReasonSets)
+{
+	checkReasonSets<F4>();
+}
+
+TEST(GB_F4, GaloisField)
+{
+	using GF = GFNumber<sint>;
+	using Poly = MultivariatePolynomial<GF>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// The largest prime below 2^32 maximizes the products of matrix entries.
+	for (unsigned prime: {101u, 4294967291u}) {
+		const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+		auto toGF = [gf](const MultivariatePolynomial<Rational>& p) {
+			Poly res;
+			for (const auto& t: p) {
+				res += Term<GF>(GF(toInt<sint>(getNum(t.coeff())), gf) / GF(toInt<sint>(getDenom(t.coeff())), gf), t.monomial());
+			}
+			return res;
+		};
+
+		Poly f1 = toGF(MultivariatePolynomial<Rational>({(Rational)1*x*x*x, (Rational)-2*x*y}));
+		Poly f2 = toGF(MultivariatePolynomial<Rational>({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x}));
+		std::vector<Poly> expected({
+			toGF(MultivariatePolynomial<Rational>({(Rational)1*x*y})),
+			toGF(MultivariatePolynomial<Rational>({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x})),
+			toGF(MultivariatePolynomial<Rational>({(Rational)1*x*x}))
+		});
+		std::sort(expected.begin(), expected.end(), Poly::compareByLeadingTerm);
+		EXPECT_EQ(expected, (basis<Poly, F4>({f1, f2})));
+
+		for (unsigned i = 3; i <= 4; i++) {
+			std::vector<Poly> input;
+			for (const auto& p: benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i)) {
+				input.push_back(toGF(p));
+			}
+			EXPECT_EQ((basis<Poly, Buchberger>(input)), (basis<Poly, F4>(input)));
+		}
+	}
+}
+
+TEST(GB_F4, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	for (unsigned i = 2; i <= 5; i++) {
+		auto input = benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		auto expected = basis<Poly, Buchberger>(input);
+		EXPECT_EQ(expected, (basis<Poly, F4>(input)));
+	}
+	for (unsigned i = 2; i <= 5; i++) {
+		auto input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		auto expected = basis<Poly, Buchberger>(input);
+		EXPECT_EQ(expected, (basis<Poly, F4>(input)));
+	}
+}
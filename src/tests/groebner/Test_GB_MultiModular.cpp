@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+
+#include "GroebnerUtil.h"
+
+using namespace carl;
+
+TEST(GB_MultiModular, RationalReconstruction)
+{
+	mpq_class res;
+	// 3 * 6936 = 2 mod 101*103
+	EXPECT_TRUE(modular_groebner::rationalReconstruction(mpz_class(6936), mpz_class(10403), res));
+	EXPECT_EQ(mpq_class(2, 3), res);
+	EXPECT_TRUE(modular_groebner::rationalReconstruction(mpz_class(-6936), mpz_class(10403), res));
+	EXPECT_EQ(mpq_class(-2, 3), res);
+	EXPECT_TRUE(modular_groebner::rationalReconstruction(mpz_class(17), mpz_class(10403), res));
+	EXPECT_EQ(mpq_class(17), res);
+}
+
+TEST(GB_MultiModular, T1)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+	MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+	MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+	GBProcedure<MultivariatePolynomial<Rational>, MultiModular, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	ASSERT_EQ(3u, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+
+	// Incremental calls compute the basis of the current basis and the new polynomials.
+	gbobject.addPolynomial(MultivariatePolynomial<Rational>({(Rational)1*y*y*y, (Rational)-1*(Rational)1/(Rational)3*x}));
+	gbobject.calculate();
+	ASSERT_EQ(2u, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(MultivariatePolynomial<Rational>(x), gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(MultivariatePolynomial<Rational>(y*y), gbobject.getIdeal().getGenerator(1));
+}
+
+TEST(GB_MultiModular, ReasonSets)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	PolynomialWithReasonSet<Rational> f1(MultivariatePolynomial<Rational>({(Rational)1*x*x*x, (Rational)-2*x*y}));
+	PolynomialWithReasonSet<Rational> f2(MultivariatePolynomial<Rational>({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x}));
+	f1.setReasons(BitVector(0));
+	f2.setReasons(BitVector(1));
+	GBProcedure<PolynomialWithReasonSet<Rational>, MultiModular, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	EXPECT_EQ(3u, gbobject.getIdeal().nrGenerators());
+	for (const auto& p: gbobject.getBasisPolynomials()) {
+		EXPECT_TRUE(p.getReasons().getBit(0));
+		EXPECT_TRUE(p.getReasons().getBit(1));
+	}
+}
+
+TEST(GB_MultiModular, Benchmarks)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	for (unsigned i = 2; i <= 4; i++) {
+		auto input = benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		auto expected = basis<Poly, Buchberger>(input);
+		EXPECT_EQ(expected, (basis<Poly, MultiModular>(input)));
+	}
+	for (unsigned i = 2; i <= 5; i++) {
+		auto input = benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		auto expected = basis<Poly, Buchberger>(input);
+		EXPECT_EQ(expected, (basis<Poly, MultiModular>(input)));
+	}
+}
+
+TEST(GB_MultiModular, Homogeneous)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable h = freshRealVariable("h");
+	auto homogenize = [h](const std::vector<Poly>& polys){
+		std::vector<Poly> res;
+		for (const auto& p: polys) {
+			std::size_t degree = p.totalDegree();
+			Poly::TermsType terms;
+			for (const auto& t: p) {
+				if (t.tdeg() == degree) terms.push_back(t);
+				else terms.emplace_back(t.coeff(), t.monomial() == nullptr ? createMonomial(h, exponent(degree)) : t.monomial() * createMonomial(h, exponent(degree - t.tdeg())));
+			}
+			res.emplace_back(std::move(terms));
+		}
+		return res;
+	};
+	std::vector<Poly> res;
+	// Non-homogeneous input is left to F4, as the modular result can not be verified.
+	EXPECT_FALSE(modular_groebner::groebnerBasis(benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(3), res));
+	for (unsigned i = 2; i <= 4; i++) {
+		auto input = homogenize(benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i));
+		EXPECT_TRUE(modular_groebner::groebnerBasis(input, res));
+		EXPECT_EQ((basis<Poly, Buchberger>(input)), (basis<Poly, MultiModular>(input)));
+	}
+	for (unsigned i = 2; i <= 4; i++) {
+		auto input = homogenize(benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i));
+		EXPECT_TRUE(modular_groebner::groebnerBasis(input, res));
+		EXPECT_EQ((basis<Poly, Buchberger>(input)), (basis<Poly, MultiModular>(input)));
+	}
+}
@@ -25,3 +25,58 @@ TEST(Ideal, Construction)
     ideal.addGenerator(p2);
     ideal.print();
 }
+
+TEST(Ideal, TrieLookup)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	std::vector<Poly> generators = {
+		Poly({(Rational)1*x*x, (Rational)1*z}),
+		Poly({(Rational)1*y*y*z}),
+		Poly({(Rational)2*x*y, (Rational)1*y}),
+		Poly({(Rational)1*z*z*z, (Rational)-1*x}),
+		Poly({(Rational)1*x*y*z*z}),
+		Poly({(Rational)1*y*y*y})
+	};
+	Ideal<Poly, IdealDatastructureVector> vector;
+	Ideal<Poly, IdealDatastructureTrie> trie;
+	for (const auto& g: generators) {
+		vector.addGenerator(g);
+		trie.addGenerator(g);
+	}
+	auto compare = [&](){
+		for (carl::uint a = 0; a < 4; a++) {
+			for (carl::uint b = 0; b < 4; b++) {
+				for (carl::uint c = 0; c < 4; c++) {
+					Term<Rational> t(Rational(3));
+					if (a > 0) t = t * createMonomial(x, a);
+					if (b > 0) t = t * createMonomial(y, b);
+					if (c > 0) t = t * createMonomial(z, c);
+					auto expected = vector.getDivisor(t);
+					auto res = trie.getDivisor(t);
+					ASSERT_EQ(expected.success(), res.success());
+					EXPECT_EQ(expected.success(), trie.isDividable(t));
+					if (!res.success()) continue;
+					EXPECT_EQ(*expected.mDivisor, *res.mDivisor);
+					EXPECT_EQ(expected.mFactor, res.mFactor);
+				}
+			}
+		}
+	};
+	compare();
+	vector.eliminateGenerator(2);
+	trie.eliminateGenerator(2);
+	vector.eliminateGenerator(5);
+	trie.eliminateGenerator(5);
+	compare();
+	vector.removeEliminated();
+	trie.removeEliminated();
+	compare();
+	trie.addGenerator(Poly({(Rational)1*x*z}));
+	vector.addGenerator(Poly({(Rational)1*x*z}));
+	compare();
+	trie.addGenerator(Poly(Rational(5)));
+	EXPECT_TRUE(trie.isDividable(Term<Rational>(Rational(1))));
+}
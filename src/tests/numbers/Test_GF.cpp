@@ -68,3 +68,22 @@ TEST(GaloisField, integers)
 
 
 
+
+TEST(GaloisField, CompoundAssignment)
+{
+    const GaloisField<mpz_class>* gf7 = GaloisFieldManager<mpz_class>::getInstance().getField(7,1);
+    GFNumber<mpz_class> a(3, gf7);
+    a += GFNumber<mpz_class>(5, gf7);
+    EXPECT_EQ(mpz_class(1), a.representingInteger());
+    EXPECT_TRUE(a.isUnit());
+    a -= GFNumber<mpz_class>(6, gf7);
+    EXPECT_EQ(mpz_class(2), a.representingInteger());
+    a *= GFNumber<mpz_class>(-3, gf7);
+    EXPECT_EQ(mpz_class(1), a.representingInteger());
+    a /= GFNumber<mpz_class>(3, gf7);
+    EXPECT_EQ(GFNumber<mpz_class>(5, gf7), a);
+    EXPECT_EQ(mpz_class(-2), a.representingInteger());
+    // The representation is unique, also for large negative values.
+    EXPECT_EQ(mpz_class(2), GFNumber<mpz_class>(-5, gf7).representingInteger());
+    EXPECT_EQ(mpz_class(-3), GFNumber<mpz_class>(-10, gf7).representingInteger());
+}
@@ -0,0 +1,213 @@
+#include "gtest/gtest.h"
+
+#include "../../carl/core/MultivariatePolynomial.h"
+#include "../../carl/core/UnivariatePolynomial.h"
+#include "../../carl/core/polynomialfunctions/GCD.h"
+#include "../../carl/numbers/numbers.h"
+
+#include "../Common.h"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace carl;
+
+namespace {
+	std::vector<mpz_class> integerSamples() {
+		sint min = std::numeric_limits<sint>::min();
+		sint max = std::numeric_limits<sint>::max();
+		std::vector<mpz_class> res;
+		for (sint i: {sint(0), sint(1), sint(-1), sint(2), sint(-3), sint(7), sint(1) << 31, sint(3037000499), sint(3037000500), min, min + 1, max, max - 1}) {
+			res.push_back(hybrid::toMpz(i));
+		}
+		res.push_back(hybrid::toMpz(max) + 1);
+		res.push_back(hybrid::toMpz(min) - 1);
+		res.push_back(hybrid::toMpz(max) * hybrid::toMpz(max));
+		return res;
+	}
+	std::vector<mpq_class> rationalSamples() {
+		std::vector<mpq_class> res;
+		auto ints = integerSamples();
+		for (const auto& n: ints) {
+			for (const auto& d: {ints[1], ints[3], ints[5], ints[6], ints[8], ints[11], ints[13]}) {
+				mpq_class q(n, d);
+				q.canonicalize();
+				res.push_back(q);
+			}
+		}
+		return res;
+	}
+}
+
+TEST(Hybrid, IntegerArithmetic)
+{
+	auto samples = integerSamples();
+	for (const auto& a: samples) {
+		HybridInteger ha(a);
+		EXPECT_EQ(a, ha.toMpz());
+		EXPECT_EQ(hybrid::fits(a.get_mpz_t()), ha.isSmall());
+		EXPECT_EQ(mpz_class(-a), (-ha).toMpz());
+		EXPECT_EQ(carl::abs(a), carl::abs(ha).toMpz());
+		for (const auto& b: samples) {
+			HybridInteger hb(b);
+			EXPECT_EQ(mpz_class(a + b), (ha + hb).toMpz());
+			EXPECT_EQ(mpz_class(a - b), (ha - hb).toMpz());
+			EXPECT_EQ(mpz_class(a * b), (ha * hb).toMpz());
+			EXPECT_EQ(a == b, ha == hb);
+			EXPECT_EQ(a < b, ha < hb);
+			EXPECT_EQ(carl::gcd(a, b), carl::gcd(ha, hb).toMpz());
+			HybridInteger hc = ha;
+			hc *= hb;
+			hc += hb;
+			EXPECT_EQ(mpz_class(a * b + b), hc.toMpz());
+			if (b != 0) {
+				EXPECT_EQ(carl::quotient(a, b), carl::quotient(ha, hb).toMpz());
+				EXPECT_EQ(carl::mod(a, b), carl::mod(ha, hb).toMpz());
+				mpz_class q, r;
+				HybridInteger hq, hr;
+				carl::divide(a, b, q, r);
+				carl::divide(ha, hb, hq, hr);
+				EXPECT_EQ(q, hq.toMpz());
+				EXPECT_EQ(r, hr.toMpz());
+			}
+		}
+	}
+	// Results are demoted if they fit into a machine integer again.
+	HybridInteger big = HybridInteger(std::numeric_limits<sint>::max()) + 1;
+	EXPECT_FALSE(big.isSmall());
+	EXPECT_TRUE((big - 1).isSmall());
+	EXPECT_EQ(HybridInteger(std::numeric_limits<sint>::max()), big - 1);
+	EXPECT_FALSE(HybridInteger(std::numeric_limits<carl::uint>::max()).isSmall());
+	// Division rounds towards negative infinity for negative operands.
+	HybridInteger q, r;
+	carl::divide(HybridInteger(-7), HybridInteger(2), q, r);
+	EXPECT_EQ(HybridInteger(-4), q);
+	EXPECT_EQ(HybridInteger(1), r);
+	carl::divide(HybridInteger(7), HybridInteger(-2), q, r);
+	EXPECT_EQ(HybridInteger(-4), q);
+	EXPECT_EQ(HybridInteger(-1), r);
+}
+
+TEST(Hybrid, MachineConversion)
+{
+	for (const auto& n: integerSamples()) {
+		bool fits = n >= hybrid::toMpz(std::numeric_limits<sint>::min()) && n <= hybrid::toMpz(std::numeric_limits<sint>::max());
+		EXPECT_EQ(fits, hybrid::fits(n.get_mpz_t()));
+		if (fits) {
+			EXPECT_EQ(n, hybrid::toMpz(hybrid::get(n.get_mpz_t())));
+		}
+	}
+	EXPECT_EQ(hybrid::toMpz(std::numeric_limits<sint>::max()) * 2 + 1, HybridInteger(std::numeric_limits<carl::uint>::max()).toMpz());
+	EXPECT_EQ(0u, hybrid::bitLength(0));
+	EXPECT_EQ(1u, hybrid::bitLength(1));
+	EXPECT_EQ(33u, hybrid::bitLength(carl::uint(1) << 32));
+	EXPECT_EQ(64u, hybrid::bitLength(std::numeric_limits<carl::uint>::max()));
+	EXPECT_EQ(64u, carl::bitsize(HybridInteger(std::numeric_limits<sint>::min())));
+}
+
+TEST(Hybrid, RationalArithmetic)
+{
+	auto samples = rationalSamples();
+	for (const auto& a: samples) {
+		HybridRational ha(a);
+		EXPECT_EQ(a, ha.toMpq());
+		EXPECT_EQ(hybrid::fits(a.get_num_mpz_t()) && hybrid::fits(a.get_den_mpz_t()), ha.isSmall());
+		EXPECT_EQ(mpq_class(-a), (-ha).toMpq());
+		EXPECT_EQ(carl::floor(a), carl::floor(ha).toMpz());
+		EXPECT_EQ(carl::ceil(a), carl::ceil(ha).toMpz());
+		EXPECT_EQ(carl::getNum(a), carl::getNum(ha).toMpz());
+		EXPECT_EQ(carl::getDenom(a), carl::getDenom(ha).toMpz());
+		EXPECT_EQ(carl::isInteger(a), carl::isInteger(ha));
+		EXPECT_DOUBLE_EQ(carl::toDouble(a), carl::toDouble(ha));
+		for (const auto& b: samples) {
+			HybridRational hb(b);
+			EXPECT_EQ(mpq_class(a + b), (ha + hb).toMpq());
+			EXPECT_EQ(mpq_class(a - b), (ha - hb).toMpq());
+			EXPECT_EQ(mpq_class(a * b), (ha * hb).toMpq());
+			EXPECT_EQ(a == b, ha == hb);
+			EXPECT_EQ(a < b, ha < hb);
+			HybridRational hc = ha;
+			hc += hb;
+			hc *= hb;
+			EXPECT_EQ(mpq_class((a + b) * b), hc.toMpq());
+			if (b != 0) {
+				EXPECT_EQ(mpq_class(a / b), (ha / hb).toMpq());
+			}
+		}
+	}
+	EXPECT_EQ(HybridRational(1, 3), HybridRational(2) / HybridRational(6));
+	EXPECT_EQ(HybridRational(-1, 2), HybridRational(3) / HybridRational(-6));
+	EXPECT_TRUE(carl::isOne(HybridRational(7) / 7));
+	EXPECT_TRUE(carl::isZero(HybridRational(1, 3) - HybridRational(2, 6)));
+}
+
+TEST(Hybrid, Interface)
+{
+	EXPECT_TRUE(is_rational<HybridRational>::value);
+	EXPECT_TRUE(is_integer<HybridInteger>::value);
+	EXPECT_TRUE(is_field<HybridRational>::value);
+	EXPECT_TRUE((std::is_same<IntegralType<HybridRational>::type, HybridInteger>::value));
+
+	EXPECT_EQ(HybridRational(1, 2), carl::parse<HybridRational>("1/2"));
+	EXPECT_EQ(HybridRational(1, 10), carl::parse<HybridRational>("0.1"));
+	EXPECT_EQ(HybridInteger(hybrid::toMpz(std::numeric_limits<sint>::max()) * 10), carl::parse<HybridInteger>("92233720368547758070"));
+	HybridRational r;
+	EXPECT_FALSE(carl::try_parse<HybridRational>("1/x", r));
+	EXPECT_EQ(HybridRational(1, 4), carl::rationalize<HybridRational>(0.25));
+
+	EXPECT_EQ("(- (/ 1 3))", carl::toString(HybridRational(-1, 3), false));
+	EXPECT_EQ(carl::toString(mpq_class(-1, 3), false), carl::toString(HybridRational(-1, 3), false));
+	EXPECT_EQ("1/3", getOutput(HybridRational(1, 3)));
+
+	HybridRational big = HybridRational(std::numeric_limits<sint>::max()) * 4;
+	EXPECT_EQ(std::hash<HybridRational>()(big), std::hash<HybridRational>()(HybridRational(big.toMpq())));
+	EXPECT_EQ(std::hash<HybridRational>()(HybridRational(2, 4)), std::hash<HybridRational>()(HybridRational(1, 2)));
+	EXPECT_EQ(HybridRational(1, 2), (convert<mpq_class, HybridRational>(mpq_class(1, 2))));
+	EXPECT_EQ(mpq_class(1, 2), (convert<HybridRational, mpq_class>(HybridRational(1, 2))));
+}
+
+TEST(Hybrid, Polynomials)
+{
+	using Poly = MultivariatePolynomial<HybridRational>;
+	using RefPoly = MultivariatePolynomial<mpq_class>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	// Coefficients of the power exceed machine integers, those of the quotient do not.
+	Poly p = (Poly(x) * HybridRational(1000003) + Poly(y) + HybridRational(1, 7)).pow(7);
+	RefPoly rp = (RefPoly(x) * mpq_class(1000003) + RefPoly(y) + mpq_class(1, 7)).pow(7);
+	EXPECT_EQ(getOutput(rp), getOutput(p));
+	Poly q = Poly(x) * HybridRational(1000003) + Poly(y) + HybridRational(1, 7);
+	Poly quot;
+	EXPECT_TRUE(p.divideBy(q, quot));
+	EXPECT_EQ(q.pow(6), quot);
+	EXPECT_EQ(Poly(HybridRational(2)), (Poly(x) * x * HybridRational(2)).substitute(x, Poly(HybridRational(1))));
+
+	using UPoly = UnivariatePolynomial<HybridRational>;
+	UPoly f(x, {HybridRational(-1), HybridRational(0), HybridRational(1)});
+	UPoly g(x, {HybridRational(1), HybridRational(1)});
+	EXPECT_EQ(g, carl::gcd(f, g).normalized());
+	EXPECT_TRUE(f.divideBy(g).remainder.isZero());
+	EXPECT_EQ(UPoly(x, {HybridRational(-1), HybridRational(1)}), f.divideBy(g).quotient);
+}
+
+TEST(Hybrid, Concurrency)
+{
+	// There is no shared state, hence numbers can be used concurrently.
+	std::vector<std::thread> threads;
+	std::vector<HybridRational> results(4);
+	for (std::size_t i = 0; i < results.size(); i++) {
+		threads.emplace_back([i, &results](){
+			HybridRational sum;
+			for (sint j = 1; j < 200; j++) sum += HybridRational(1, j + sint(i));
+			results[i] = sum;
+		});
+	}
+	for (auto& t: threads) t.join();
+	for (std::size_t i = 0; i < results.size(); i++) {
+		mpq_class sum;
+		for (sint j = 1; j < 200; j++) sum += mpq_class(1, static_cast<unsigned long>(j + sint(i)));
+		EXPECT_EQ(sum, results[i].toMpq());
+	}
+}
@@ -30,6 +30,28 @@ TEST(Parser, Polynomial)
 //    EXPECT_EQ(polCheck, pol2);
 }
 
+TEST(Parser, HybridRational)
+{
+	using MP = MultivariatePolynomial<HybridRational>;
+	carl::parser::PolynomialParser<MP> parser;
+	carl::Variable x = freshRealVariable("x");
+	parser.addVariable(x);
+	auto parse = [&parser](const std::string& s) {
+		MP res;
+		auto begin = s.begin();
+		EXPECT_TRUE(boost::spirit::qi::phrase_parse(begin, s.end(), parser, boost::spirit::qi::space, res));
+		EXPECT_TRUE(begin == s.end());
+		return res;
+	};
+
+	EXPECT_EQ(MP(HybridRational(3)), parse("3"));
+	EXPECT_EQ(HybridRational(2)*x, parse("2*x"));
+	EXPECT_EQ(HybridRational(3, 2)*x, parse("1.5*x"));
+	EXPECT_EQ(MP(HybridRational(1, 4)), parse("0.25"));
+	EXPECT_EQ(x*x - HybridRational(1), parse("x^2 - 1"));
+	EXPECT_EQ(MP(HybridRational(mpz_class("123456789012345678901234567890"))), parse("123456789012345678901234567890"));
+}
+
 TEST(Parser, RationalFunction)
 {
 	using MP = MultivariatePolynomial<Rational>;
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/util/TermAdditionManager.h"
+
+#include "../Common.h"
+
+#include <thread>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using TAM = TermAdditionManager<Poly, Poly::OrderedBy>;
+
+namespace {
+	Poly collect(TAM& tam, const std::vector<Term<Rational>>& terms) {
+		auto id = tam.getId(terms.size());
+		for (const auto& t: terms) tam.addTerm<false>(id, t);
+		std::vector<Term<Rational>> res;
+		tam.readTerms(id, res);
+		return Poly(std::move(res), false);
+	}
+}
+
+TEST(TermAdditionManager, Dense)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	TAM tam;
+	Poly p = collect(tam, {Term<Rational>(2, x, 1), Term<Rational>(3, y, 2), Term<Rational>(1), Term<Rational>(-2, x, 1), Term<Rational>(4, y, 2)});
+	EXPECT_EQ(Poly(Rational(7) * y * y + Rational(1)), p);
+	EXPECT_EQ(std::size_t(1), tam.entries());
+}
+
+TEST(TermAdditionManager, Sparse)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Term<Rational>> terms;
+	Poly expected;
+	for (carl::uint e = 1; e < 20; e++) {
+		terms.emplace_back(Rational(e), createMonomial(x, e) * createMonomial(y, 20 - e));
+		terms.emplace_back(Rational(1), createMonomial(x, e));
+		terms.emplace_back(Rational(-1), createMonomial(x, e));
+		expected += Term<Rational>(Rational(e), createMonomial(x, e) * createMonomial(y, 20 - e));
+	}
+	// Only ids below two are stored densely, hence the hash map is used from the start.
+	TAM sparse(2);
+	EXPECT_EQ(expected, collect(sparse, terms));
+	EXPECT_EQ(expected, collect(sparse, terms));
+
+	// Monomials created after getId() exceed the bound and force a switch to the hash map.
+	TAM tam(MonomialPool::getInstance().largestID() + 1);
+	auto id = tam.getId(0);
+	tam.addTerm<true>(id, Term<Rational>(Rational(5), x, 1));
+	Variable z = freshRealVariable("z");
+	tam.addTerm<true>(id, Term<Rational>(Rational(1), z, 3));
+	tam.addTerm<true>(id, Term<Rational>(Rational(-5), x, 1));
+	tam.addTerm<true>(id, Term<Rational>(Rational(2), z, 3));
+	std::vector<Term<Rational>> res;
+	tam.readTerms(id, res);
+	EXPECT_EQ(Poly(Rational(3) * z * z * z), Poly(std::move(res), false));
+}
+
+TEST(TermAdditionManager, Release)
+{
+	Variable x = freshRealVariable("x");
+	TAM tam;
+	auto outer = tam.getId(100000);
+	auto inner = tam.getId(100000);
+	EXPECT_EQ(std::size_t(2), tam.entries());
+	tam.addTerm<false>(inner, Term<Rational>(Rational(1), x, 1));
+	tam.dropTerms(inner);
+	// Releasing keeps entries that are in use.
+	tam.release();
+	EXPECT_EQ(std::size_t(1), tam.entries());
+	tam.addTerm<false>(outer, Term<Rational>(Rational(1), x, 2));
+	std::vector<Term<Rational>> res;
+	tam.readTerms(outer, res);
+	EXPECT_EQ(std::size_t(1), res.size());
+	// Large scratch buffers are not kept.
+	EXPECT_LT(tam.memoryUsage(), (TAM::MaxIdleTerms + 1) * sizeof(Term<Rational>) + (MonomialPool::getInstance().largestID() + 1) * 2 * sizeof(TAM::IDType));
+
+	// Idle entries are removed on the next use after a release request.
+	auto id1 = tam.getId(0);
+	auto id2 = tam.getId(0);
+	EXPECT_EQ(std::size_t(2), tam.entries());
+	tam.dropTerms(id2);
+	tam.dropTerms(id1);
+	releaseTermAdditionManagers();
+	tam.dropTerms(tam.getId(0));
+	EXPECT_EQ(std::size_t(1), tam.entries());
+}
+
+TEST(TermAdditionManager, ThreadLocal)
+{
+	Variable x = freshRealVariable("x");
+	const TAM* mainManager = &Poly::termAdditionManager();
+	const TAM* threadManager = nullptr;
+	Poly p;
+	std::thread t([&](){
+		threadManager = &Poly::termAdditionManager();
+		p = Poly(x) * (Poly(x) + Rational(1)) + Rational(2);
+	});
+	t.join();
+	EXPECT_NE(mainManager, threadManager);
+	EXPECT_EQ(Poly(x) * x + x + Rational(2), p);
+}